@@ -0,0 +1,320 @@
+/**
+ * Esempio di scrittura e lettura di grandi array di interi in un file binario
+ * compresso a blocchi.
+ *
+ * es_fwrite_array.c scrive gli interi "grezzi" (4 byte ciascuno) e nel metodo
+ * alternativo li rilegge con una fread per ogni intero. Quando gli interi sono
+ * miliardi conviene:
+ *  - leggere e scrivere a blocchi (una fread per blocco e non per intero);
+ *  - comprimere ogni blocco con la codifica delta + frame of reference (FOR):
+ *      1) delta: al posto dei valori si memorizzano le differenze tra valori
+ *         consecutivi (per dati ordinati o quasi ordinati sono numeri piccoli);
+ *      2) FOR: si sottrae a tutte le differenze la differenza minima del blocco,
+ *         così ottengo solo valori >= 0;
+ *      3) bit-packing: ogni valore viene scritto usando solo i bit necessari
+ *         per rappresentare il valore massimo del blocco.
+ *
+ * Formato del file: una sequenza di blocchi, ognuno composto da
+ *   - intestazione (struct IntestazioneBlocco, 4 campi uint32_t)
+ *   - ceil(n * bit / 32) parole uint32_t con i valori impacchettati
+ *
+ * Il ciclo di spacchettamento è scritto senza salti condizionali e con un
+ * numero fisso di elementi per blocco: compilando con -O3 (e -march=native)
+ * il compilatore lo vettorizza con le istruzioni SIMD disponibili.
+ *
+ * Compilazione: gcc -O3 -march=native es_fwrite_array_compresso.c -o compresso
+ *
+ * @file es_fwrite_array_compresso.c
+ * @date 18.10.2026
+ * @version 1.0
+ * @author Filippo Bilardo
+ *
+ * @see es_fwrite_array.c
+ * @see https://lemire.me/blog/2012/02/08/effective-compression-using-frame-of-reference-and-delta-coding/
+ */
+#include <stdio.h>    // FILE, fopen, fwrite, fread, fclose, perror, printf
+#include <stdlib.h>   // EXIT_FAILURE, malloc, free, rand
+#include <stdint.h>   // uint32_t, int32_t, uint64_t
+#include <string.h>   // memset
+#include <time.h>     // timespec_get
+
+/// Numero di interi contenuti in un blocco completo
+#define DIM_BLOCCO 128
+/// Numero massimo di parole da 32 bit occupate da un blocco impacchettato
+/// (+1 parola di margine per lo spacchettamento senza salti condizionali)
+#define MAX_PAROLE (DIM_BLOCCO + 1)
+
+/// Intestazione scritta all'inizio di ogni blocco
+struct IntestazioneBlocco {
+    uint32_t n;          // numero di interi nel blocco (<= DIM_BLOCCO)
+    uint32_t primo;      // primo valore del blocco
+    uint32_t min_delta;  // differenza minima del blocco (frame of reference)
+    uint32_t bit;        // bit usati per ogni valore impacchettato (0..32)
+};
+
+/// Lettore "in streaming": restituisce il file un blocco alla volta
+struct LettoreBlocchi {
+    FILE *file;
+    int32_t blocco[DIM_BLOCCO];  // ultimo blocco decodificato
+    size_t n;                    // numero di interi validi in blocco[]
+};
+
+/// Numero di bit necessari per rappresentare x
+static uint32_t bitNecessari(uint32_t x) {
+    uint32_t b = 0;
+    while (x != 0) {
+        b++;
+        x >>= 1;
+    }
+    return b;
+}
+
+/**
+ * Comprime e scrive nel file un blocco di n interi (n <= DIM_BLOCCO).
+ * Restituisce 1 in caso di successo, 0 in caso di errore di scrittura.
+ */
+int scriviBlocco(FILE *file, const int32_t *dati, size_t n) {
+    uint32_t delta[DIM_BLOCCO];
+    uint32_t parole[MAX_PAROLE];
+    struct IntestazioneBlocco h;
+
+    // 1) delta: l'aritmetica senza segno evita l'overflow (comportamento definito)
+    h.n = (uint32_t)n;
+    h.primo = (uint32_t)dati[0];
+    delta[0] = 0;
+    for (size_t i = 1; i < n; i++) {
+        delta[i] = (uint32_t)dati[i] - (uint32_t)dati[i - 1];
+    }
+
+    // 2) frame of reference: cerco la differenza minima (con segno) del blocco
+    int32_t min = n > 1 ? (int32_t)delta[1] : 0;
+    for (size_t i = 2; i < n; i++) {
+        if ((int32_t)delta[i] < min) min = (int32_t)delta[i];
+    }
+    h.min_delta = (uint32_t)min;
+    uint32_t max = 0;
+    for (size_t i = 1; i < n; i++) {
+        delta[i] -= h.min_delta;
+        if (delta[i] > max) max = delta[i];
+    }
+    delta[0] = 0;
+
+    // 3) bit-packing
+    h.bit = bitNecessari(max);
+    size_t num_parole = (n * h.bit + 31) / 32;
+    memset(parole, 0, sizeof(parole));
+    for (size_t i = 0; i < n; i++) {
+        size_t pos = i * h.bit;
+        size_t p = pos / 32;
+        unsigned s = pos % 32;
+        uint64_t v = (uint64_t)delta[i] << s;
+        parole[p] |= (uint32_t)v;
+        parole[p + 1] |= (uint32_t)(v >> 32);
+    }
+
+    if (fwrite(&h, sizeof(h), 1, file) != 1) return 0;
+    if (fwrite(parole, sizeof(uint32_t), num_parole, file) != num_parole) return 0;
+    return 1;
+}
+
+/**
+ * Spacchetta n valori da bit bit ciascuno, poi ricostruisce i valori originali
+ * con la somma prefissa delle differenze.
+ */
+static void decodificaBlocco(const uint32_t *parole, const struct IntestazioneBlocco *h,
+                             int32_t *out) {
+    uint32_t delta[DIM_BLOCCO];
+    const uint32_t bit = h->bit;
+    const uint64_t maschera = bit == 32 ? 0xFFFFFFFFu : (((uint64_t)1 << bit) - 1);
+
+    // Ciclo senza salti condizionali: vettorizzabile dal compilatore
+    for (uint32_t i = 0; i < DIM_BLOCCO; i++) {
+        uint32_t pos = i * bit;
+        uint32_t p = pos >> 5;
+        uint32_t s = pos & 31;
+        uint64_t due_parole = ((uint64_t)parole[p + 1] << 32) | parole[p];
+        delta[i] = (uint32_t)((due_parole >> s) & maschera);
+    }
+
+    // Somma prefissa: ricostruisce i valori a partire dal primo
+    uint32_t valore = h->primo;
+    out[0] = (int32_t)valore;
+    for (uint32_t i = 1; i < h->n; i++) {
+        valore += delta[i] + h->min_delta;
+        out[i] = (int32_t)valore;
+    }
+}
+
+/// Inizializza il lettore sul file già aperto in lettura
+void apriLettore(struct LettoreBlocchi *l, FILE *file) {
+    l->file = file;
+    l->n = 0;
+}
+
+/**
+ * Legge e decodifica il blocco successivo in l->blocco.
+ * Restituisce il numero di interi letti (0 a fine file o in caso di errore).
+ */
+size_t leggiBlocco(struct LettoreBlocchi *l) {
+    struct IntestazioneBlocco h;
+    uint32_t parole[MAX_PAROLE + 1];
+
+    l->n = 0;
+    if (fread(&h, sizeof(h), 1, l->file) != 1) return 0;
+    if (h.n == 0 || h.n > DIM_BLOCCO || h.bit > 32) {
+        fprintf(stderr, "Blocco non valido nel file compresso\n");
+        return 0;
+    }
+    size_t num_parole = (h.n * h.bit + 31) / 32;
+    // Azzero le parole non scritte nel file (blocco parziale o bit == 0)
+    memset(parole, 0, sizeof(parole));
+    if (fread(parole, sizeof(uint32_t), num_parole, l->file) != num_parole) {
+        perror("Errore durante la lettura del blocco");
+        return 0;
+    }
+    decodificaBlocco(parole, &h, l->blocco);
+    l->n = h.n;
+    return l->n;
+}
+
+/// Scrive n interi nel file compresso, blocco per blocco
+int scriviArrayCompresso(const char *nome, const int32_t *dati, size_t n) {
+    FILE *file = fopen(nome, "wb");
+    if (file == NULL) {
+        perror("Errore durante l'apertura del file binario");
+        return 0;
+    }
+    for (size_t i = 0; i < n; i += DIM_BLOCCO) {
+        size_t quanti = n - i < DIM_BLOCCO ? n - i : DIM_BLOCCO;
+        if (!scriviBlocco(file, dati + i, quanti)) {
+            perror("Errore durante la scrittura del file binario");
+            fclose(file);
+            return 0;
+        }
+    }
+    fclose(file);
+    return 1;
+}
+
+/// Tempo in secondi da un istante arbitrario (orologio di sistema, C11)
+static double secondi(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/// Dimensione del file in byte
+static long dimensioneFile(const char *nome) {
+    FILE *file = fopen(nome, "rb");
+    if (file == NULL) return -1;
+    fseek(file, 0, SEEK_END);
+    long dim = ftell(file);
+    fclose(file);
+    return dim;
+}
+
+int main() {
+    // Dati di prova: 10 milioni di "timestamp" crescenti con incrementi piccoli
+    const size_t N = 10 * 1000 * 1000;
+    int32_t *dati = malloc(N * sizeof(int32_t));
+    int32_t *letti = malloc(N * sizeof(int32_t));
+    if (dati == NULL || letti == NULL) {
+        perror("Memoria insufficiente");
+        return EXIT_FAILURE;
+    }
+    srand(1);
+    dati[0] = 1000;
+    for (size_t i = 1; i < N; i++) {
+        dati[i] = dati[i - 1] + rand() % 100;
+    }
+
+    // 1) Scrittura e lettura "grezza" con fwrite/fread (come es_fwrite_array.c)
+    FILE *file = fopen("array_grezzo.bin", "wb");
+    if (file == NULL || fwrite(dati, sizeof(int32_t), N, file) != N) {
+        perror("Errore durante la scrittura del file binario");
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+
+    double t0 = secondi();
+    file = fopen("array_grezzo.bin", "rb");
+    if (file == NULL || fread(letti, sizeof(int32_t), N, file) != N) {
+        perror("Errore durante la lettura del file binario");
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+    double t_grezzo = secondi() - t0;
+
+    // 2) Scrittura compressa e lettura in streaming a blocchi
+    if (!scriviArrayCompresso("array_compresso.bin", dati, N)) {
+        return EXIT_FAILURE;
+    }
+    memset(letti, 0, N * sizeof(int32_t));
+
+    t0 = secondi();
+    file = fopen("array_compresso.bin", "rb");
+    if (file == NULL) {
+        perror("Errore durante l'apertura del file binario");
+        return EXIT_FAILURE;
+    }
+    struct LettoreBlocchi lettore;
+    apriLettore(&lettore, file);
+    size_t totale = 0;
+    size_t quanti;
+    while ((quanti = leggiBlocco(&lettore)) > 0 && totale + quanti <= N) {
+        memcpy(letti + totale, lettore.blocco, quanti * sizeof(int32_t));
+        totale += quanti;
+    }
+    fclose(file);
+    double t_compresso = secondi() - t0;
+
+    // 3) Solo decodifica (file già in memoria): misura la velocità del codec
+    long dim_compresso = dimensioneFile("array_compresso.bin");
+    unsigned char *buffer = malloc(dim_compresso);
+    file = fopen("array_compresso.bin", "rb");
+    if (buffer == NULL || file == NULL ||
+        fread(buffer, 1, dim_compresso, file) != (size_t)dim_compresso) {
+        perror("Errore durante la lettura del file binario");
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+    t0 = secondi();
+    long offset = 0;
+    size_t decodificati = 0;
+    uint32_t parole[MAX_PAROLE + 1];
+    while (offset < dim_compresso) {
+        struct IntestazioneBlocco h;
+        memcpy(&h, buffer + offset, sizeof(h));
+        offset += sizeof(h);
+        size_t num_parole = (h.n * h.bit + 31) / 32;
+        memset(parole, 0, sizeof(parole));
+        memcpy(parole, buffer + offset, num_parole * sizeof(uint32_t));
+        offset += num_parole * sizeof(uint32_t);
+        decodificaBlocco(parole, &h, letti + decodificati);
+        decodificati += h.n;
+    }
+    double t_decodifica = secondi() - t0;
+    free(buffer);
+
+    // Verifica: i dati riletti devono coincidere con quelli scritti
+    int ok = totale == N && decodificati == N;
+    for (size_t i = 0; ok && i < N; i++) {
+        if (letti[i] != dati[i]) ok = 0;
+    }
+    printf("Verifica dei dati riletti: %s\n", ok ? "OK" : "ERRORE");
+
+    double gb = N * sizeof(int32_t) / 1e9;
+    printf("Interi: %zu\n", N);
+    printf("Dimensione file grezzo   : %ld byte\n", dimensioneFile("array_grezzo.bin"));
+    printf("Dimensione file compresso: %ld byte (%.1f%%)\n", dim_compresso,
+           100.0 * dim_compresso / dimensioneFile("array_grezzo.bin"));
+    printf("Lettura grezza (fread)   : %.3f s, %.2f GB/s\n", t_grezzo, gb / t_grezzo);
+    printf("Lettura compressa        : %.3f s, %.2f GB/s\n", t_compresso, gb / t_compresso);
+    printf("Solo decodifica          : %.3f s, %.2f GB/s\n", t_decodifica, gb / t_decodifica);
+
+    free(dati);
+    free(letti);
+    remove("array_grezzo.bin");
+    remove("array_compresso.bin");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
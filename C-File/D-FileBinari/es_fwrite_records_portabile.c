@@ -0,0 +1,256 @@
+/**
+ * Esempio di scrittura di record in un file binario "portabile", cioè leggibile
+ * su qualsiasi macchina indipendentemente da padding ed endianness.
+ *
+ * In es_fwrite_records.c la struct Record viene scritta con fwrite così com'è in
+ * memoria. Qui ogni record viene prima serializzato con il formato fisso definito
+ * in serializza.h (vedi il commento iniziale del file) e poi scritto con fwrite.
+ *
+ * Il programma:
+ *  1) scrive e rilegge i record di es_fwrite_records.c in formato portabile;
+ *  2) verifica il formato con un record di riferimento byte per byte;
+ *  3) esegue un "fuzz test": serializza e deserializza record casuali e
+ *     deserializza buffer di byte casuali controllando che le stringhe lette
+ *     siano sempre terminate;
+ *  4) misura la velocità di serializzazione rispetto alla copia con memcpy.
+ *
+ * Compilazione: gcc -O2 es_fwrite_records_portabile.c -o records_portabile
+ *
+ * @file es_fwrite_records_portabile.c
+ * @author Filippo Bilardo
+ * @date 18.10.2026
+ * @version 1.0
+ */
+#include <stdio.h>  // FILE, fopen, fwrite, fclose, perror, printf
+#include <stdlib.h> // EXIT_FAILURE, malloc, rand
+#include <string.h> // memcmp, memcpy, strcmp, strlen
+#include <time.h>   // timespec_get
+#include "serializza.h"
+
+/// Struttura per rappresentare un record (da es_fwrite_records.c)
+struct Record {
+    char name[32];
+    int age;
+};
+#define RECORD_CAMPI(X) \
+    X(STRINGA, name, 32) \
+    X(INT32,   age,  0)
+SERIALIZZATORE(Record, RECORD_CAMPI)
+
+/// Indirizzo (da B-Strutture_dati/struct/struct06.c)
+struct indirizzo {
+    char citta[128];
+    char via[128];
+    int civico;
+};
+#define INDIRIZZO_CAMPI(X) \
+    X(STRINGA, citta,  128) \
+    X(STRINGA, via,    128) \
+    X(INT32,   civico, 0)
+SERIALIZZATORE(indirizzo, INDIRIZZO_CAMPI)
+
+/// Persona (da B-Strutture_dati/struct/struct04.c)
+struct Persona {
+    char nome[50];
+    int eta;
+    float altezza;
+};
+#define PERSONA_CAMPI(X) \
+    X(STRINGA, nome,    50) \
+    X(INT32,   eta,     0)  \
+    X(FLOAT32, altezza, 0)
+SERIALIZZATORE(Persona, PERSONA_CAMPI)
+
+/// Studente (da B-Strutture_dati/struct/struct05.c)
+struct Studente {
+    char nome[50];
+    int eta;
+    float media;
+};
+#define STUDENTE_CAMPI(X) \
+    X(STRINGA, nome,  50) \
+    X(INT32,   eta,   0)  \
+    X(FLOAT32, media, 0)
+SERIALIZZATORE(Studente, STUDENTE_CAMPI)
+
+//------------------------------------------------------------------------------------------
+//=== 1) SCRITTURA E LETTURA DEL FILE ======================================================
+//------------------------------------------------------------------------------------------
+int scriviRecord(const char *nome_file, const struct Record *records, size_t n) {
+    FILE *fp = fopen(nome_file, "wb");
+    if (fp == NULL) {
+        perror("Errore nell'apertura del file");
+        return 0;
+    }
+    unsigned char buffer[Record_DIM];
+    for (size_t i = 0; i < n; i++) {
+        Record_serializza(&records[i], buffer);
+        if (fwrite(buffer, Record_DIM, 1, fp) != 1) {
+            perror("Errore nella scrittura del file");
+            fclose(fp);
+            return 0;
+        }
+    }
+    fclose(fp);
+    return 1;
+}
+
+int stampaRecord(const char *nome_file) {
+    FILE *fp = fopen(nome_file, "rb");
+    if (fp == NULL) {
+        perror("Errore nell'apertura del file");
+        return 0;
+    }
+    unsigned char buffer[Record_DIM];
+    struct Record r;
+    while (fread(buffer, Record_DIM, 1, fp) == 1) {
+        Record_deserializza(&r, buffer);
+        printf("Nome: %s\n", r.name);
+        printf("Età: %d\n", r.age);
+    }
+    fclose(fp);
+    return 1;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) VERIFICA DEL FORMATO ==============================================================
+//------------------------------------------------------------------------------------------
+/// Il formato deve essere identico su ogni macchina: confronto con i byte attesi
+int verificaFormato(void) {
+    struct Persona p = {"Mario Rossi", 30, 1.75f};
+    unsigned char atteso[Persona_DIM] = {0};
+    memcpy(atteso, "Mario Rossi", 11);
+    // 30 = 0x0000001E in little-endian
+    atteso[50] = 0x1E;
+    // 1.75f = 0x3FE00000 in little-endian
+    atteso[56] = 0xE0;
+    atteso[57] = 0x3F;
+
+    unsigned char buffer[Persona_DIM];
+    Persona_serializza(&p, buffer);
+    return Persona_DIM == 58 && memcmp(buffer, atteso, Persona_DIM) == 0;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 3) FUZZ TEST =========================================================================
+//------------------------------------------------------------------------------------------
+/// Stringa casuale da 0 a n-1 caratteri, riempita di '\0' come con strncpy
+static void stringaCasuale(char *s, size_t n) {
+    size_t len = rand() % n;
+    memset(s, 0, n);
+    for (size_t i = 0; i < len; i++) s[i] = (char)(1 + rand() % 255);
+}
+
+/// Restituisce il numero di errori trovati
+int fuzzTest(int iterazioni) {
+    int errori = 0;
+    for (int k = 0; k < iterazioni; k++) {
+        // Andata e ritorno: i valori deserializzati devono coincidere con gli originali
+        struct indirizzo a, b;
+        stringaCasuale(a.citta, sizeof(a.citta));
+        stringaCasuale(a.via, sizeof(a.via));
+        a.civico = rand() - RAND_MAX / 2;
+        unsigned char buf[indirizzo_DIM];
+        unsigned char buf2[indirizzo_DIM];
+        indirizzo_serializza(&a, buf);
+        indirizzo_deserializza(&b, buf);
+        if (strcmp(a.citta, b.citta) != 0 || strcmp(a.via, b.via) != 0 || a.civico != b.civico) {
+            errori++;
+        }
+        // Riserializzando il record letto si devono ottenere gli stessi byte
+        indirizzo_serializza(&b, buf2);
+        if (memcmp(buf, buf2, indirizzo_DIM) != 0) errori++;
+
+        struct Studente s, t;
+        stringaCasuale(s.nome, sizeof(s.nome));
+        s.eta = rand();
+        s.media = (float)rand() / RAND_MAX * 30.0f;
+        unsigned char bs[Studente_DIM];
+        Studente_serializza(&s, bs);
+        Studente_deserializza(&t, bs);
+        if (strcmp(s.nome, t.nome) != 0 || s.eta != t.eta || s.media != t.media) errori++;
+
+        // Byte casuali (file corrotto): le stringhe lette devono essere terminate
+        for (size_t i = 0; i < Studente_DIM; i++) bs[i] = (unsigned char)rand();
+        Studente_deserializza(&t, bs);
+        if (strlen(t.nome) >= sizeof(t.nome)) errori++;
+    }
+    return errori;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 4) VELOCITÀ ==========================================================================
+//------------------------------------------------------------------------------------------
+static double secondi(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmark(size_t n) {
+    struct Record *records = malloc(n * sizeof(struct Record));
+    struct Record *letti = malloc(n * sizeof(struct Record));
+    unsigned char *buffer = malloc(n * sizeof(struct Record) + n * Record_DIM);
+    if (records == NULL || letti == NULL || buffer == NULL) {
+        perror("Memoria insufficiente");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < n; i++) {
+        stringaCasuale(records[i].name, sizeof(records[i].name));
+        records[i].age = rand() % 100;
+    }
+
+    const int RIPETIZIONI = 10;
+    double t0 = secondi();
+    for (int r = 0; r < RIPETIZIONI; r++) {
+        memcpy(buffer, records, n * sizeof(struct Record));  // come fwrite della struct
+        memcpy(letti, buffer, n * sizeof(struct Record));    // come fread della struct
+    }
+    double t_memcpy = (secondi() - t0) / RIPETIZIONI;
+
+    t0 = secondi();
+    for (int r = 0; r < RIPETIZIONI; r++) {
+        unsigned char *p = buffer;
+        for (size_t i = 0; i < n; i++) p = Record_serializza(&records[i], p);
+        const unsigned char *q = buffer;
+        for (size_t i = 0; i < n; i++) q = Record_deserializza(&letti[i], q);
+    }
+    double t_serial = (secondi() - t0) / RIPETIZIONI;
+
+    double mb = n * (double)Record_DIM / 1e6;
+    printf("Record: %zu (sizeof = %zu, nel file = %d byte)\n",
+           n, sizeof(struct Record), Record_DIM);
+    printf("memcpy andata e ritorno       : %.4f s, %.0f MB/s\n", t_memcpy, 2 * mb / t_memcpy);
+    printf("serializza + deserializza     : %.4f s, %.0f MB/s (%.0f%% di memcpy)\n",
+           t_serial, 2 * mb / t_serial, 100.0 * t_memcpy / t_serial);
+
+    free(records);
+    free(letti);
+    free(buffer);
+}
+
+int main() {
+    // Creazione di un vettore di record
+    struct Record records[] = {
+        {"Alice", 30},
+        {"Bob", 25},
+        {"Charlie", 35}
+    };
+    size_t num_records = sizeof(records) / sizeof(records[0]);
+
+    printf("Scrittura dei record in formato portabile...\n");
+    if (!scriviRecord("records_portabili.bin", records, num_records)) return EXIT_FAILURE;
+    printf("Lettura dei record dal file...\n");
+    if (!stampaRecord("records_portabili.bin")) return EXIT_FAILURE;
+
+    int formato_ok = verificaFormato();
+    printf("\nVerifica del formato: %s\n", formato_ok ? "OK" : "ERRORE");
+
+    srand(1);
+    int errori = fuzzTest(100000);
+    printf("Fuzz test: %d errori\n\n", errori);
+
+    benchmark(1000000);
+
+    return formato_ok && errori == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
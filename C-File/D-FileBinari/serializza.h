@@ -0,0 +1,139 @@
+/** ****************************************************************************************
+* @file serializza.h
+* @brief Serializzazione portabile di struct con layout fisso (little-endian, senza padding)
+*
+* Scrivere una struct con fwrite(&r, sizeof(r), 1, fp) salva in memoria anche:
+*  - i byte di padding inseriti dal compilatore (diversi tra compilatori/architetture);
+*  - gli interi nell'ordine dei byte della macchina (little o big endian).
+* Il file così ottenuto può non essere leggibile su un'altra macchina.
+*
+* Qui il formato su file è fissato una volta per tutte: i campi vengono scritti
+* uno dopo l'altro, senza padding, interi e float in little-endian, stringhe come
+* array di lunghezza fissa.
+*
+* I campi di una struct si elencano una sola volta con una "X-macro":
+*
+*   #define RECORD_CAMPI(X) \
+*       X(STRINGA, name, 32) \
+*       X(INT32,   age,  0)
+*   SERIALIZZATORE(Record, RECORD_CAMPI)
+*
+* e il preprocessore genera, per ogni struct:
+*   - Record_DIM: numero di byte occupati nel file (costante di compilazione);
+*   - Record_serializza(const struct Record *s, unsigned char *p);
+*   - Record_deserializza(struct Record *s, const unsigned char *p).
+* Il codice generato è una sequenza di istruzioni per i singoli campi, senza
+* cicli sui campi né puntatori a funzione.
+*
+* Tipi di campo supportati:
+*   STRINGA (char[n]), INT32 (int), FLOAT32 (float IEEE 754)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef SERIALIZZA_H
+#define SERIALIZZA_H
+
+#include <stdint.h> // uint32_t, int32_t
+#include <string.h> // memcpy
+
+//------------------------------------------------------------------------------------------
+//=== FUNZIONI DI BASE =====================================================================
+//------------------------------------------------------------------------------------------
+/// Scrive v in 4 byte little-endian (su x86/ARM il compilatore la riduce ad una mov)
+static inline void ser_scrivi_u32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+/// Legge 4 byte little-endian
+static inline uint32_t ser_leggi_u32(const unsigned char *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline void ser_scrivi_float(unsigned char *p, float f) {
+    uint32_t v;
+    memcpy(&v, &f, sizeof(v)); // stessi bit del float, senza violare l'aliasing
+    ser_scrivi_u32(p, v);
+}
+
+static inline float ser_leggi_float(const unsigned char *p) {
+    uint32_t v = ser_leggi_u32(p);
+    float f;
+    memcpy(&f, &v, sizeof(f));
+    return f;
+}
+
+/**
+ * Copia tutti gli n byte della stringa, come farebbe fwrite della struct.
+ * Per ottenere file identici a parità di dati, i byte dopo il terminatore
+ * devono valere '\0': inizializzare le stringhe con = {0}, con un
+ * inizializzatore "..." oppure con strncpy, che riempie di '\0'.
+ */
+static inline void ser_scrivi_stringa(unsigned char *p, const char *s, size_t n) {
+    memcpy(p, s, n);
+}
+
+/// Copia la stringa garantendo il terminatore anche con dati non validi
+static inline void ser_leggi_stringa(char *s, const unsigned char *p, size_t n) {
+    memcpy(s, p, n);
+    s[n - 1] = '\0';
+}
+
+//------------------------------------------------------------------------------------------
+//=== GENERAZIONE DEL CODICE ===============================================================
+//------------------------------------------------------------------------------------------
+// Dimensione nel file di ciascun tipo di campo
+#define SER_DIM_STRINGA(campo, n) + (n)
+#define SER_DIM_INT32(campo, n)   + 4
+#define SER_DIM_FLOAT32(campo, n) + 4
+#define SER_DIM(tipo, campo, n) SER_DIM_##tipo(campo, n)
+
+// Controlli a tempo di compilazione: la X-macro deve corrispondere alla struct
+#define SER_VERIFICA_STRINGA(campo, n) \
+    _Static_assert(sizeof(s->campo) == (n), "lunghezza errata per " #campo);
+#define SER_VERIFICA_INT32(campo, n) \
+    _Static_assert(sizeof(s->campo) == 4, #campo " non e' un intero a 32 bit");
+#define SER_VERIFICA_FLOAT32(campo, n) \
+    _Static_assert(sizeof(s->campo) == 4, #campo " non e' un float a 32 bit");
+#define SER_VERIFICA(tipo, campo, n) SER_VERIFICA_##tipo(campo, n)
+
+// Scrittura di un campo all'offset corrente e avanzamento del puntatore
+#define SER_SCRIVI_STRINGA(campo, n) ser_scrivi_stringa(p, s->campo, n); p += (n);
+#define SER_SCRIVI_INT32(campo, n)   ser_scrivi_u32(p, (uint32_t)s->campo); p += 4;
+#define SER_SCRIVI_FLOAT32(campo, n) ser_scrivi_float(p, s->campo); p += 4;
+#define SER_SCRIVI(tipo, campo, n) SER_SCRIVI_##tipo(campo, n)
+
+// Lettura di un campo
+#define SER_LEGGI_STRINGA(campo, n) ser_leggi_stringa(s->campo, p, n); p += (n);
+#define SER_LEGGI_INT32(campo, n)   s->campo = (int32_t)ser_leggi_u32(p); p += 4;
+#define SER_LEGGI_FLOAT32(campo, n) s->campo = ser_leggi_float(p); p += 4;
+#define SER_LEGGI(tipo, campo, n) SER_LEGGI_##tipo(campo, n)
+
+/**
+* @brief Genera costante di dimensione e funzioni di (de)serializzazione per struct Tipo
+* @param Tipo nome della struct (senza la parola struct)
+* @param CAMPI X-macro con l'elenco dei campi nell'ordine del file
+*/
+#define SERIALIZZATORE(Tipo, CAMPI)                                                  \
+    enum { Tipo##_DIM = 0 CAMPI(SER_DIM) };                                         \
+                                                                                    \
+    /* Scrive la struct in p (Tipo##_DIM byte); restituisce il byte successivo */   \
+    static inline unsigned char *Tipo##_serializza(const struct Tipo *s,            \
+                                                   unsigned char *p) {              \
+        CAMPI(SER_VERIFICA)                                                         \
+        CAMPI(SER_SCRIVI)                                                           \
+        return p;                                                                   \
+    }                                                                               \
+                                                                                    \
+    /* Legge la struct da p (Tipo##_DIM byte); restituisce il byte successivo */    \
+    static inline const unsigned char *Tipo##_deserializza(struct Tipo *s,          \
+                                                           const unsigned char *p) {\
+        CAMPI(SER_LEGGI)                                                            \
+        return p;                                                                   \
+    }
+
+#endif
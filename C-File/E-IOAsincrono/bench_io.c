@@ -0,0 +1,179 @@
+/**
+ * Confronto di velocità tra I/O bloccante (stdio) e I/O asincrono con doppio
+ * buffer (libreria io_asincrono), con page cache "fredda" e "calda".
+ *
+ * Prove eseguite:
+ *  1) array di interi (come es_fwrite_array.c): scrittura e lettura con somma
+ *     degli elementi letti, per simulare l'elaborazione dei dati;
+ *  2) copia di file (come copiafile.c).
+ *
+ * Cache fredda: prima di ogni prova si chiede al kernel di scartare le pagine
+ * del file dalla page cache (posix_fadvise POSIX_FADV_DONTNEED), quindi i dati
+ * vengono davvero letti dal disco. Cache calda: il file è già in memoria.
+ *
+ * Compilazione: gcc -O2 bench_io.c io_asincrono.c -o bench_io -lpthread
+ * Esecuzione:   ./bench_io [MiB]            (io_uring se disponibile)
+ *               IO_ASINCRONO=thread ./bench_io [MiB]   (pool di thread)
+ *
+ * @file bench_io.c
+ * @date 18.10.2026
+ * @version 1.0
+ * @author Filippo Bilardo
+ */
+#define _GNU_SOURCE
+#include <stdio.h>    // FILE, fopen, fread, fwrite, printf
+#include <stdlib.h>   // EXIT_FAILURE, atoi, malloc
+#include <stdint.h>   // int32_t, int64_t
+#include <fcntl.h>    // open, posix_fadvise
+#include <unistd.h>   // fsync, close
+#include <time.h>     // clock_gettime
+#include "io_asincrono.h"
+
+#define DIM_BLOCCO_STDIO (1 << 20)
+
+static double secondi(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/// Scarta il file dalla page cache (dopo averlo scritto su disco)
+static void svuotaCache(const char *nome) {
+    int fd = open(nome, O_RDONLY);
+    if (fd < 0) return;
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+}
+
+/// Elaborazione dei dati letti: somma degli interi
+static int64_t somma(const unsigned char *dati, long n) {
+    const int32_t *v = (const int32_t *)dati;
+    int64_t s = 0;
+    for (long i = 0; i < n / (long)sizeof(int32_t); i++) s += v[i];
+    return s;
+}
+
+static int64_t leggiStdio(const char *nome) {
+    static unsigned char buffer[DIM_BLOCCO_STDIO];
+    FILE *file = fopen(nome, "rb");
+    if (file == NULL) return -1;
+    int64_t s = 0;
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) s += somma(buffer, n);
+    fclose(file);
+    return s;
+}
+
+static int64_t leggiAsincrono(const char *nome) {
+    LettoreAsincrono *l = la_apri(nome, 0);
+    if (l == NULL) return -1;
+    int64_t s = 0;
+    const unsigned char *blocco;
+    long n;
+    while ((n = la_leggi(l, &blocco)) > 0) s += somma(blocco, n);
+    la_chiudi(l);
+    return s;
+}
+
+static void scriviStdio(const char *nome, size_t num_int) {
+    static int32_t buffer[DIM_BLOCCO_STDIO / sizeof(int32_t)];
+    const size_t per_blocco = sizeof(buffer) / sizeof(int32_t);
+    FILE *file = fopen(nome, "wb");
+    if (file == NULL) return;
+    for (size_t i = 0; i < num_int; i += per_blocco) {
+        for (size_t j = 0; j < per_blocco; j++) buffer[j] = (int32_t)(i + j);
+        fwrite(buffer, sizeof(int32_t), per_blocco, file);
+    }
+    fclose(file);
+}
+
+static void scriviAsincrono(const char *nome, size_t num_int) {
+    static int32_t buffer[DIM_BLOCCO_STDIO / sizeof(int32_t)];
+    const size_t per_blocco = sizeof(buffer) / sizeof(int32_t);
+    ScrittoreAsincrono *s = sa_apri(nome, 0);
+    if (s == NULL) return;
+    for (size_t i = 0; i < num_int; i += per_blocco) {
+        for (size_t j = 0; j < per_blocco; j++) buffer[j] = (int32_t)(i + j);
+        sa_scrivi(s, buffer, sizeof(buffer));
+    }
+    sa_chiudi(s);
+}
+
+static void copiaStdio(const char *src, const char *dst) {
+    static unsigned char buffer[DIM_BLOCCO_STDIO];
+    FILE *in = fopen(src, "rb");
+    FILE *out = fopen(dst, "wb");
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0) fwrite(buffer, 1, n, out);
+    fclose(in);
+    fclose(out);
+}
+
+static void copiaAsincrono(const char *src, const char *dst) {
+    LettoreAsincrono *in = la_apri(src, 0);
+    ScrittoreAsincrono *out = sa_apri(dst, 0);
+    const unsigned char *blocco;
+    long n;
+    while ((n = la_leggi(in, &blocco)) > 0) sa_scrivi(out, blocco, n);
+    la_chiudi(in);
+    sa_chiudi(out);
+}
+
+static void stampa(const char *prova, double mib, double t) {
+    printf("%-36s %8.3f s %10.1f MiB/s\n", prova, t, mib / t);
+}
+
+int main(int argc, char *argv[]) {
+    size_t mib = argc > 1 ? (size_t)atoi(argv[1]) : 256;
+    size_t num_int = mib * (1 << 20) / sizeof(int32_t);
+    const char *nome = "bench_io.bin";
+    const char *copia = "bench_io_copia.bin";
+    double t0;
+
+    printf("File di prova: %zu MiB, I/O asincrono con %s\n\n", mib, io_backend());
+
+    t0 = secondi();
+    scriviStdio(nome, num_int);
+    svuotaCache(nome);
+    stampa("scrittura stdio (+fdatasync)", mib, secondi() - t0);
+
+    t0 = secondi();
+    scriviAsincrono(nome, num_int);
+    svuotaCache(nome);
+    stampa("scrittura asincrona (+fdatasync)", mib, secondi() - t0);
+
+    for (int caldo = 0; caldo <= 1; caldo++) {
+        const char *cache = caldo ? "calda" : "fredda";
+        char prova[64];
+        int64_t s1, s2;
+
+        printf("\n--- page cache %s ---\n", cache);
+        if (!caldo) svuotaCache(nome);
+        t0 = secondi();
+        s1 = leggiStdio(nome);
+        stampa("lettura + somma stdio", mib, secondi() - t0);
+
+        if (!caldo) svuotaCache(nome);
+        t0 = secondi();
+        s2 = leggiAsincrono(nome);
+        stampa("lettura + somma asincrona", mib, secondi() - t0);
+        if (s1 != s2) printf("ERRORE: somme diverse (%lld, %lld)\n", (long long)s1, (long long)s2);
+
+        if (!caldo) svuotaCache(nome);
+        t0 = secondi();
+        copiaStdio(nome, copia);
+        snprintf(prova, sizeof(prova), "copia stdio");
+        stampa(prova, mib, secondi() - t0);
+
+        if (!caldo) svuotaCache(nome);
+        t0 = secondi();
+        copiaAsincrono(nome, copia);
+        snprintf(prova, sizeof(prova), "copia asincrona");
+        stampa(prova, mib, secondi() - t0);
+    }
+
+    remove(nome);
+    remove(copia);
+    return EXIT_SUCCESS;
+}
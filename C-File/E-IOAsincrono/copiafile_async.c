@@ -0,0 +1,58 @@
+/*
+copiafile_async.c
+18/10/2026
+
+Versione di copiafile.c basata sulla libreria io_asincrono:
+invece di copiare un carattere alla volta con fgetc/fputc, il file viene
+letto a blocchi da 1 MiB con read-ahead e scritto con write-behind, così
+la lettura del blocco successivo avviene mentre si scrive quello corrente.
+
+Compilazione: gcc -O2 copiafile_async.c io_asincrono.c -o copiafile_async -lpthread
+*/
+#include <stdio.h>
+#include "io_asincrono.h"
+
+int copyFile(char src[], char dst[]) {
+
+    LettoreAsincrono *input = la_apri(src, 0);
+    ScrittoreAsincrono *output = sa_apri(dst, 0);
+
+    if (input == NULL || output == NULL) {
+        perror("Errore nell'apertura dei file");
+        la_chiudi(input);
+        if (output != NULL) sa_chiudi(output);
+        return 1;
+    }
+
+    const unsigned char *blocco;
+    long n;
+    int errore = 0;
+    while ((n = la_leggi(input, &blocco)) > 0) {
+        if (sa_scrivi(output, blocco, n) != 0) {
+            errore = 1;
+            break;
+        }
+    }
+    if (n < 0) errore = 1;
+
+    la_chiudi(input);
+    if (sa_chiudi(output) != 0) errore = 1;
+    if (errore) {
+        perror("Errore durante la copia");
+    }
+    return errore;
+}
+
+int main(int argc, char *argv[]) {
+
+    if (argc == 1) {
+        printf("Utilizzo: \n%s SOURCE [DESTINATION]\n", argv[0]);
+        return 1;
+    }
+
+    if (argc != 3) {
+        return copyFile(argv[1], "out.txt");
+    } else {
+        return copyFile(argv[1], argv[2]);
+    }
+}
@@ -0,0 +1,99 @@
+/**
+ * @file fileShow_async.c
+ * @date 18/10/2026
+ *
+ * @brief Stampa il contenuto di un file in esadecimale e ASCII (I/O asincrono).
+ *
+ * Stesso output di fileShow.c, ma il file viene letto a blocchi con la
+ * libreria io_asincrono: mentre si formatta un blocco, il successivo viene
+ * già letto dal disco. Anche l'output viene preparato in un buffer e scritto
+ * con una sola fwrite per blocco.
+ *
+ * Compilazione: gcc -O2 fileShow_async.c io_asincrono.c -o fileShow_async -lpthread
+ *
+ * @versione 1.0
+ */
+#include <stdio.h>
+#include "io_asincrono.h"
+
+#define BYTE_PER_RIGA 16
+/// Lunghezza massima di una riga: indirizzo (8 cifre, fino a 16 oltre i 4 GB),
+/// ": ", 16 byte in esadecimale (49), ' ', 16 caratteri ASCII, '\n' = 85
+#define DIM_RIGA 88
+
+void printHexAndAscii(LettoreAsincrono *file);
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        printf("Utilizzo: %s <nome_del_file>\n", argv[0]);
+        return 1;
+    }
+
+    LettoreAsincrono *file = la_apri(argv[1], 0);
+
+    if (file == NULL) {
+        perror("Errore nell'apertura del file");
+        return 1;
+    }
+
+    printHexAndAscii(file);
+    la_chiudi(file);
+
+    return 0;
+}
+
+/// Formatta una riga (al massimo 16 byte) in out; restituisce i caratteri scritti
+static int formattaRiga(char *out, size_t address, const unsigned char *buffer, size_t bytesRead) {
+    static const char hex[] = "0123456789abcdef";
+    int len = sprintf(out, "%08zx: ", address);
+
+    for (size_t i = 0; i < BYTE_PER_RIGA; i++) {
+        if (i < bytesRead) {
+            out[len++] = hex[buffer[i] >> 4];
+            out[len++] = hex[buffer[i] & 0x0F];
+            out[len++] = ' ';
+        } else {
+            out[len++] = ' '; // Stampa spazi per byte mancanti
+            out[len++] = ' ';
+            out[len++] = ' ';
+        }
+
+        if (i == 7) {
+            out[len++] = ' '; // Spazio aggiuntivo tra i primi 8 byte
+        }
+    }
+
+    out[len++] = ' ';
+
+    for (size_t i = 0; i < bytesRead; i++) {
+        if (buffer[i] >= 32 && buffer[i] <= 126) {
+            out[len++] = buffer[i]; // Caratteri ASCII stampati
+        } else {
+            out[len++] = '.'; // Caratteri non stampabili sostituiti con un punto
+        }
+    }
+
+    out[len++] = '\n';
+    return len;
+}
+
+void printHexAndAscii(LettoreAsincrono *file) {
+    static char uscita[(IO_DIM_BUFFER / BYTE_PER_RIGA) * DIM_RIGA];
+    const unsigned char *blocco;
+    long bytesRead;
+    size_t address = 0;
+
+    // I blocchi hanno dimensione multipla di 16: le righe non sono mai spezzate
+    while ((bytesRead = la_leggi(file, &blocco)) > 0) {
+        size_t len = 0;
+        for (long i = 0; i < bytesRead; i += BYTE_PER_RIGA) {
+            size_t n = bytesRead - i < BYTE_PER_RIGA ? bytesRead - i : BYTE_PER_RIGA;
+            len += formattaRiga(uscita + len, address, blocco + i, n);
+            address += n;
+        }
+        fwrite(uscita, 1, len, stdout);
+    }
+    if (bytesRead < 0) {
+        perror("Errore durante la lettura del file");
+    }
+}
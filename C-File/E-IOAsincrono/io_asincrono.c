@@ -0,0 +1,464 @@
+/** ****************************************************************************************
+* @file io_asincrono.c
+* @brief Implementazione della libreria di I/O asincrono con doppio buffer
+*
+* Ogni buffer è associato ad una "richiesta" (lettura o scrittura di un blocco
+* ad un certo offset del file). Le richieste vengono avviate con avvia() e
+* completate con attendi(); in mezzo il programma è libero di lavorare.
+*
+* Due implementazioni:
+*  - io_uring: le richieste vengono inserite nella coda di invio (SQ) condivisa
+*    con il kernel e i risultati letti dalla coda di completamento (CQ).
+*    Si usano direttamente le chiamate di sistema, senza liburing.
+*  - pool di thread: le richieste vengono messe in una coda e NUM_THREAD
+*    thread le eseguono con pread/pwrite.
+*
+* NOTA: lettori e scrittori vanno usati da un solo thread del programma.
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#define _GNU_SOURCE
+#include "io_asincrono.h"
+
+#include <errno.h>      // errno
+#include <fcntl.h>      // open
+#include <pthread.h>    // pthread_create, pthread_mutex_t, pthread_cond_t
+#include <stdint.h>     // uintptr_t
+#include <stdlib.h>     // malloc, free, getenv, posix_memalign
+#include <string.h>     // memset, memcpy, strcmp
+#include <sys/mman.h>   // mmap
+#include <sys/syscall.h>// syscall, __NR_io_uring_setup, __NR_io_uring_enter
+#include <unistd.h>     // pread, pwrite, close
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#endif
+
+#define VOCI_ANELLO 64   // dimensione delle code di io_uring
+#define NUM_THREAD  2    // thread del pool
+#define DIM_CODA    64   // richieste in attesa nel pool
+
+enum { OP_LEGGI, OP_SCRIVI };
+
+/// Richiesta di I/O associata ad un buffer
+struct Richiesta {
+    int op;
+    int fd;
+    unsigned char *buf;
+    size_t len;
+    off_t off;
+    int in_corso;     // avviata e non ancora attesa
+    int completata;   // il risultato è disponibile
+    long risultato;   // byte trasferiti oppure -errno
+};
+
+static int usa_io_uring = 0;
+static pthread_once_t inizializzato = PTHREAD_ONCE_INIT;
+static int errore_avvio = 0;   // codice di errore se il pool di thread non è partito
+
+/// Esegue la richiesta in modo sincrono, ripetendo pread/pwrite fino alla fine
+static long esegui(int op, int fd, unsigned char *buf, size_t len, off_t off) {
+    size_t fatti = 0;
+    while (fatti < len) {
+        ssize_t n = op == OP_LEGGI ? pread(fd, buf + fatti, len - fatti, off + fatti)
+                                   : pwrite(fd, buf + fatti, len - fatti, off + fatti);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) break; // fine file
+        fatti += n;
+    }
+    return (long)fatti;
+}
+
+//------------------------------------------------------------------------------------------
+//=== IO_URING =============================================================================
+//------------------------------------------------------------------------------------------
+#if defined(__linux__) && defined(__NR_io_uring_setup)
+static struct {
+    int fd;
+    unsigned *sq_tail, *sq_mask, *sq_array;
+    struct io_uring_sqe *sqes;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_cqe *cqes;
+} anello;
+
+/// Crea l'anello di io_uring; restituisce 0 se il kernel lo supporta
+static int anello_inizializza(void) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    int fd = (int)syscall(__NR_io_uring_setup, VOCI_ANELLO, &p);
+    if (fd < 0) return -1;
+    // IORING_OP_READ/WRITE esistono dal kernel 5.6, lo stesso di IORING_FEAT_RW_CUR_POS
+    if (!(p.features & IORING_FEAT_RW_CUR_POS)) {
+        close(fd);
+        return -1;
+    }
+
+    size_t dim_sq = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    size_t dim_cq = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (dim_cq > dim_sq) dim_sq = dim_cq;
+        dim_cq = dim_sq;
+    }
+    unsigned char *sq = mmap(NULL, dim_sq, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             fd, IORING_OFF_SQ_RING);
+    unsigned char *cq = sq;
+    if (sq != MAP_FAILED && !(p.features & IORING_FEAT_SINGLE_MMAP)) {
+        cq = mmap(NULL, dim_cq, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                  fd, IORING_OFF_CQ_RING);
+    }
+    void *sqes = mmap(NULL, p.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sq == MAP_FAILED || cq == MAP_FAILED || sqes == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+
+    anello.fd = fd;
+    anello.sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    anello.sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+    anello.sq_array = (unsigned *)(sq + p.sq_off.array);
+    anello.sqes = sqes;
+    anello.cq_head = (unsigned *)(cq + p.cq_off.head);
+    anello.cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    anello.cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+    anello.cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+    return 0;
+}
+
+/// Inserisce la richiesta nella coda di invio e la passa subito al kernel
+static void anello_invia(struct Richiesta *r) {
+    unsigned coda = *anello.sq_tail;
+    unsigned i = coda & *anello.sq_mask;
+    struct io_uring_sqe *sqe = &anello.sqes[i];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = r->op == OP_LEGGI ? IORING_OP_READ : IORING_OP_WRITE;
+    sqe->fd = r->fd;
+    sqe->addr = (unsigned long)r->buf;
+    sqe->len = (unsigned)r->len;
+    sqe->off = (unsigned long long)r->off;
+    sqe->user_data = (unsigned long long)(uintptr_t)r;
+    anello.sq_array[i] = i;
+    __atomic_store_n(anello.sq_tail, coda + 1, __ATOMIC_RELEASE);
+
+    while (syscall(__NR_io_uring_enter, anello.fd, 1, 0, 0, NULL, 0) < 0) {
+        if (errno == EINTR || errno == EAGAIN || errno == EBUSY) continue;
+        // Invio fallito: la richiesta viene eseguita subito in modo sincrono
+        __atomic_store_n(anello.sq_tail, coda, __ATOMIC_RELEASE);
+        r->risultato = esegui(r->op, r->fd, r->buf, r->len, r->off);
+        r->completata = 1;
+        return;
+    }
+}
+
+/// Raccoglie i completamenti finché la richiesta r non è terminata
+static void anello_attendi(struct Richiesta *r) {
+    while (!r->completata) {
+        unsigned testa = *anello.cq_head;
+        if (testa == __atomic_load_n(anello.cq_tail, __ATOMIC_ACQUIRE)) {
+            syscall(__NR_io_uring_enter, anello.fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+            continue;
+        }
+        struct io_uring_cqe *cqe = &anello.cqes[testa & *anello.cq_mask];
+        struct Richiesta *c = (struct Richiesta *)(uintptr_t)cqe->user_data;
+        c->risultato = cqe->res;
+        c->completata = 1;
+        __atomic_store_n(anello.cq_head, testa + 1, __ATOMIC_RELEASE);
+    }
+}
+#else
+static int anello_inizializza(void) { return -1; }
+static void anello_invia(struct Richiesta *r) { (void)r; }
+static void anello_attendi(struct Richiesta *r) { (void)r; }
+#endif
+
+//------------------------------------------------------------------------------------------
+//=== POOL DI THREAD =======================================================================
+//------------------------------------------------------------------------------------------
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t c_lavoro;   // c'è una richiesta in coda
+    pthread_cond_t c_fatto;    // una richiesta è stata completata
+    struct Richiesta *coda[DIM_CODA];
+    unsigned testa, n;
+} pool = {
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .c_lavoro = PTHREAD_COND_INITIALIZER,
+    .c_fatto = PTHREAD_COND_INITIALIZER,
+};
+
+static void *pool_lavoratore(void *arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&pool.mutex);
+        while (pool.n == 0) pthread_cond_wait(&pool.c_lavoro, &pool.mutex);
+        struct Richiesta *r = pool.coda[pool.testa];
+        pool.testa = (pool.testa + 1) % DIM_CODA;
+        pool.n--;
+        pthread_mutex_unlock(&pool.mutex);
+
+        long risultato = esegui(r->op, r->fd, r->buf, r->len, r->off);
+
+        pthread_mutex_lock(&pool.mutex);
+        r->risultato = risultato;
+        r->completata = 1;
+        pthread_cond_broadcast(&pool.c_fatto);
+        pthread_mutex_unlock(&pool.mutex);
+    }
+    return NULL;
+}
+
+/// Avvia i thread del pool; restituisce 0 se ne è partito almeno uno, altrimenti il codice di errore
+static int pool_inizializza(void) {
+    int avviati = 0, errore = 0;
+    for (int i = 0; i < NUM_THREAD; i++) {
+        pthread_t t;
+        errore = pthread_create(&t, NULL, pool_lavoratore, NULL);
+        if (errore != 0) break;
+        pthread_detach(t);
+        avviati++;
+    }
+    return avviati > 0 ? 0 : errore;
+}
+
+static void pool_invia(struct Richiesta *r) {
+    pthread_mutex_lock(&pool.mutex);
+    if (pool.n == DIM_CODA) {
+        // Coda piena: eseguo la richiesta nel thread chiamante
+        pthread_mutex_unlock(&pool.mutex);
+        r->risultato = esegui(r->op, r->fd, r->buf, r->len, r->off);
+        r->completata = 1;
+        return;
+    }
+    pool.coda[(pool.testa + pool.n) % DIM_CODA] = r;
+    pool.n++;
+    pthread_cond_signal(&pool.c_lavoro);
+    pthread_mutex_unlock(&pool.mutex);
+}
+
+static void pool_attendi(struct Richiesta *r) {
+    pthread_mutex_lock(&pool.mutex);
+    while (!r->completata) pthread_cond_wait(&pool.c_fatto, &pool.mutex);
+    pthread_mutex_unlock(&pool.mutex);
+}
+
+//------------------------------------------------------------------------------------------
+//=== RICHIESTE ============================================================================
+//------------------------------------------------------------------------------------------
+static void inizializza(void) {
+    const char *scelta = getenv("IO_ASINCRONO");
+    if ((scelta == NULL || strcmp(scelta, "thread") != 0) && anello_inizializza() == 0) {
+        usa_io_uring = 1;
+    } else {
+        usa_io_uring = 0;
+        // Senza thread le richieste resterebbero in coda per sempre: la_apri e sa_apri falliscono
+        errore_avvio = pool_inizializza();
+    }
+}
+
+const char *io_backend(void) {
+    pthread_once(&inizializzato, inizializza);
+    if (errore_avvio != 0) return "nessuno (pool di thread non avviato)";
+    return usa_io_uring ? "io_uring" : "pool di thread";
+}
+
+static void avvia(struct Richiesta *r) {
+    r->in_corso = 1;
+    r->completata = 0;
+    if (usa_io_uring) {
+        anello_invia(r);
+    } else {
+        pool_invia(r);
+    }
+}
+
+/// Attende la fine della richiesta; restituisce i byte trasferiti o -errno
+static long attendi(struct Richiesta *r) {
+    if (!r->in_corso) return 0;
+    if (usa_io_uring) {
+        anello_attendi(r);
+        // io_uring può trasferire meno byte di quelli richiesti: completo il resto
+        if (r->risultato > 0 && (size_t)r->risultato < r->len) {
+            long resto = esegui(r->op, r->fd, r->buf + r->risultato,
+                                r->len - r->risultato, r->off + r->risultato);
+            r->risultato = resto < 0 ? resto : r->risultato + resto;
+        }
+    } else {
+        pool_attendi(r);
+    }
+    r->in_corso = 0;
+    return r->risultato;
+}
+
+static unsigned char *alloca_buffer(size_t dim) {
+    void *p = NULL;
+    // Allineamento alla pagina: evita copie parziali di pagina nel kernel
+    if (posix_memalign(&p, 4096, dim) != 0) return NULL;
+    return p;
+}
+
+//------------------------------------------------------------------------------------------
+//=== LETTORE ==============================================================================
+//------------------------------------------------------------------------------------------
+struct LettoreAsincrono {
+    int fd;
+    size_t dim;
+    off_t prossimo;          // offset della prossima lettura da avviare
+    struct Richiesta r[2];
+    int corrente;            // buffer restituito all'ultima chiamata
+    int restituito;          // 1 se r[corrente] è in mano al programma
+    int ultimo;              // l'ultimo blocco letto era incompleto: fine file
+};
+
+LettoreAsincrono *la_apri(const char *nome, size_t dim_buffer) {
+    pthread_once(&inizializzato, inizializza);
+    if (errore_avvio != 0) {
+        errno = errore_avvio;
+        return NULL;
+    }
+    LettoreAsincrono *l = calloc(1, sizeof(LettoreAsincrono));
+    if (l == NULL) return NULL;
+    l->dim = dim_buffer ? dim_buffer : IO_DIM_BUFFER;
+    l->fd = open(nome, O_RDONLY);
+    if (l->fd < 0) {
+        free(l);
+        return NULL;
+    }
+    for (int i = 0; i < 2; i++) {
+        l->r[i].buf = alloca_buffer(l->dim);
+        if (l->r[i].buf == NULL) {
+            la_chiudi(l);
+            errno = ENOMEM;
+            return NULL;
+        }
+    }
+    // Read-ahead: avvio subito la lettura dei primi due blocchi
+    for (int i = 0; i < 2; i++) {
+        struct Richiesta *r = &l->r[i];
+        r->op = OP_LEGGI;
+        r->fd = l->fd;
+        r->len = l->dim;
+        r->off = l->prossimo;
+        l->prossimo += l->dim;
+        avvia(r);
+    }
+    return l;
+}
+
+long la_leggi(LettoreAsincrono *l, const unsigned char **dati) {
+    if (l->ultimo) return 0;
+    if (l->restituito) {
+        // Il programma ha finito con il buffer precedente: lo riuso per leggere in anticipo
+        struct Richiesta *r = &l->r[l->corrente];
+        r->off = l->prossimo;
+        l->prossimo += l->dim;
+        avvia(r);
+        l->corrente = 1 - l->corrente;
+    }
+    long n = attendi(&l->r[l->corrente]);
+    l->restituito = 1;
+    if (n < 0) {
+        errno = (int)-n;
+        l->ultimo = 1;
+        return -1;
+    }
+    if ((size_t)n < l->dim) l->ultimo = 1;
+    *dati = l->r[l->corrente].buf;
+    return n;
+}
+
+void la_chiudi(LettoreAsincrono *l) {
+    if (l == NULL) return;
+    for (int i = 0; i < 2; i++) {
+        attendi(&l->r[i]); // il kernel non deve più scrivere nel buffer
+        free(l->r[i].buf);
+    }
+    close(l->fd);
+    free(l);
+}
+
+//------------------------------------------------------------------------------------------
+//=== SCRITTORE ============================================================================
+//------------------------------------------------------------------------------------------
+struct ScrittoreAsincrono {
+    int fd;
+    size_t dim;
+    off_t off;               // offset della prossima scrittura
+    struct Richiesta r[2];
+    int corrente;            // buffer che si sta riempiendo
+    size_t usati;            // byte occupati nel buffer corrente
+    int errore;
+};
+
+ScrittoreAsincrono *sa_apri(const char *nome, size_t dim_buffer) {
+    pthread_once(&inizializzato, inizializza);
+    if (errore_avvio != 0) {
+        errno = errore_avvio;
+        return NULL;
+    }
+    ScrittoreAsincrono *s = calloc(1, sizeof(ScrittoreAsincrono));
+    if (s == NULL) return NULL;
+    s->dim = dim_buffer ? dim_buffer : IO_DIM_BUFFER;
+    s->fd = open(nome, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (s->fd < 0) {
+        free(s);
+        return NULL;
+    }
+    for (int i = 0; i < 2; i++) {
+        s->r[i].op = OP_SCRIVI;
+        s->r[i].fd = s->fd;
+        s->r[i].buf = alloca_buffer(s->dim);
+        if (s->r[i].buf == NULL) {
+            sa_chiudi(s);
+            errno = ENOMEM;
+            return NULL;
+        }
+    }
+    return s;
+}
+
+/// Write-behind: avvia la scrittura del buffer corrente e passa all'altro
+static void invia_corrente(ScrittoreAsincrono *s) {
+    struct Richiesta *r = &s->r[s->corrente];
+    r->len = s->usati;
+    r->off = s->off;
+    s->off += s->usati;
+    avvia(r);
+
+    s->corrente = 1 - s->corrente;
+    s->usati = 0;
+    // Prima di riempire l'altro buffer aspetto che la sua scrittura sia finita
+    if (attendi(&s->r[s->corrente]) < 0) s->errore = 1;
+}
+
+int sa_scrivi(ScrittoreAsincrono *s, const void *dati, size_t n) {
+    const unsigned char *p = dati;
+    while (n > 0) {
+        size_t quanti = s->dim - s->usati;
+        if (quanti > n) quanti = n;
+        memcpy(s->r[s->corrente].buf + s->usati, p, quanti);
+        s->usati += quanti;
+        p += quanti;
+        n -= quanti;
+        if (s->usati == s->dim) invia_corrente(s);
+    }
+    return s->errore ? -1 : 0;
+}
+
+int sa_chiudi(ScrittoreAsincrono *s) {
+    if (s == NULL) return -1;
+    if (s->usati > 0 && s->r[s->corrente].buf != NULL) invia_corrente(s);
+    for (int i = 0; i < 2; i++) {
+        if (attendi(&s->r[i]) < 0) s->errore = 1;
+        free(s->r[i].buf);
+    }
+    if (close(s->fd) != 0) s->errore = 1;
+    int esito = s->errore ? -1 : 0;
+    free(s);
+    return esito;
+}
@@ -0,0 +1,87 @@
+/** ****************************************************************************************
+* @file io_asincrono.h
+* @brief Piccola libreria di I/O asincrono su file con doppio buffer
+*
+* Con stdio (fread/fwrite) il programma si ferma ad aspettare il disco ad ogni
+* lettura o scrittura. Con il doppio buffer, mentre il programma elabora un
+* buffer, il sistema operativo riempie (read-ahead) o svuota (write-behind)
+* l'altro: l'I/O si sovrappone all'elaborazione.
+*
+* Le operazioni vengono eseguite con io_uring (Linux >= 5.6, il primo con
+* IORING_OP_READ/WRITE) quando il kernel lo supporta, altrimenti con un
+* piccolo pool di thread che esegue pread/pwrite.
+* Impostando la variabile d'ambiente IO_ASINCRONO=thread si forza il pool di thread.
+*
+* Compilazione: gcc -O2 programma.c io_asincrono.c -o programma -lpthread
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef IO_ASINCRONO_H
+#define IO_ASINCRONO_H
+
+#include <stddef.h> // size_t
+
+/// Dimensione predefinita di ciascuno dei due buffer
+#define IO_DIM_BUFFER (1 << 20)
+
+typedef struct LettoreAsincrono LettoreAsincrono;
+typedef struct ScrittoreAsincrono ScrittoreAsincrono;
+
+/**
+* @brief Apre un file in lettura e avvia subito la lettura dei primi due buffer
+* @param nome nome del file
+* @param dim_buffer dimensione di ciascun buffer (0 = IO_DIM_BUFFER)
+* @return il lettore oppure NULL in caso di errore (errno impostato)
+*/
+LettoreAsincrono *la_apri(const char *nome, size_t dim_buffer);
+
+/**
+* @brief Restituisce il prossimo blocco di dati letto dal file
+* @param l lettore
+* @param dati riceve il puntatore ai dati, valido fino alla chiamata successiva
+* @return numero di byte disponibili, 0 a fine file, -1 in caso di errore
+*
+* Il buffer restituito nella chiamata precedente viene riutilizzato per
+* leggere in anticipo il blocco successivo.
+*/
+long la_leggi(LettoreAsincrono *l, const unsigned char **dati);
+
+/**
+* @brief Chiude il lettore e libera le risorse
+*/
+void la_chiudi(LettoreAsincrono *l);
+
+/**
+* @brief Crea (o tronca) un file per la scrittura
+* @param nome nome del file
+* @param dim_buffer dimensione di ciascun buffer (0 = IO_DIM_BUFFER)
+* @return lo scrittore oppure NULL in caso di errore (errno impostato)
+*/
+ScrittoreAsincrono *sa_apri(const char *nome, size_t dim_buffer);
+
+/**
+* @brief Accoda n byte al file
+* @return 0 in caso di successo, -1 in caso di errore
+*
+* I dati vengono copiati nel buffer corrente; quando è pieno la scrittura
+* parte in background e si continua a riempire l'altro buffer.
+*/
+int sa_scrivi(ScrittoreAsincrono *s, const void *dati, size_t n);
+
+/**
+* @brief Scrive i dati rimasti nel buffer, attende le scritture e chiude il file
+* @return 0 in caso di successo, -1 se una scrittura è fallita
+*/
+int sa_chiudi(ScrittoreAsincrono *s);
+
+/**
+* @brief Nome del meccanismo usato per l'I/O ("io_uring" o "pool di thread")
+*
+* Se non è stato possibile avviare nessun thread del pool, la_apri e sa_apri
+* restituiscono NULL con errno impostato.
+*/
+const char *io_backend(void);
+
+#endif
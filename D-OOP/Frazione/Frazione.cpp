@@ -1,63 +1,44 @@
 // Direttive di preprocessore
 #include <iostream> //cout, cin
+#include "Frazione.h" // Definizione della classe Frazione
 
 using namespace std; // Per le funzioni cout e cin
 
-// Definizione della classe
-class Frazione {
-private:
-	// Definizione degli attributi di classe
-	int numeratore;
-	int denominatore;
-
-public:
-	// Costruttore di default
-	Frazione() {}
-
-	// Metodi setters
-	void setNumeratore(int n) {
-		numeratore = n;
-	}
-
-	void setDenominatore(int n) {
-		denominatore = n;
-	}
-
-	// Metodi getters
-	int getNumeratore() {
-		return numeratore;
-	}
-
-	int getDenominatore() {
-		return denominatore;
-	}
-
-	// Definizione dei metodi
-	void stampa() {  // Metodo che stampa a video la frazione
-		/* quando l'invocazione di un metodo è all'interno della  
-		classe non usiamo la dot notation (spiegata in seguito) */
-		//semplifica();
-		cout << numeratore << "/" << denominatore << endl;
-	}
-
-	void semplifica() { // Metodo che semplifica gli argomenti della frazione
-		int min;
-		min = MCD(numeratore, denominatore);
-		numeratore = numeratore / min;
-		denominatore = denominatore / min;
-	}
-
-	int MCD(int a, int b) { // Metodo che calcola il MCD (algoritmo di Euclide)
-	
-		return 0;
-	}
-};
+// Le frazioni constexpr sono calcolate dal compilatore: se il risultato è
+// sbagliato il programma non compila nemmeno
+static_assert(Frazione(1, 2) + Frazione(1, 3) == Frazione(5, 6));
+static_assert(Frazione(15, 5) == Frazione(3));
+static_assert(Frazione(2, -4) < Frazione(0));
+static_assert(Frazione::MCD(48, 18) == 6);
 
 int main() { // Funzione principale
 	Frazione f1; 			// Definizione di un oggetto di classe Frazione
 	//f1.numeratore=5;   	// ERRATA perché numeratore è private
 	f1.setNumeratore(15); 	// Chiamata del metodo setNumeratore sull'oggetto
 	f1.setDenominatore(5);
-	f1.stampa(); 	// Semplificazione automatica (stampa chiama semplifica: f1 vale 4)
+	f1.stampa(); 	// Semplificazione automatica (i setter chiamano semplifica: f1 vale 3/1)
+
+	// Operatori aritmetici e di confronto
+	Frazione f2(3, 4), f3(-5, 6);
+	cout << f2 << " + " << f3 << " = " << f2 + f3 << endl;
+	cout << f2 << " - " << f3 << " = " << f2 - f3 << endl;
+	cout << f2 << " * " << f3 << " = " << f2 * f3 << endl;
+	cout << f2 << " / " << f3 << " = " << f2 / f3 << endl;
+	cout << f2 << (f2 > f3 ? " > " : " <= ") << f3 << endl;
+
+	// Gli errori vengono segnalati con le eccezioni
+	try {
+		Frazione f4 = f2 / Frazione(0);
+		f4.stampa();
+	} catch (const exception &e) {
+		cout << "Errore: " << e.what() << endl;
+	}
+	try {
+		Frazione f5(INT64_MAX, 2);
+		f5 = f5 * Frazione(3);
+		f5.stampa();
+	} catch (const exception &e) {
+		cout << "Errore: " << e.what() << endl;
+	}
 	return 0;
 }
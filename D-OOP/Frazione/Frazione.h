@@ -0,0 +1,222 @@
+/** ****************************************************************************************
+* @file Frazione.h
+* @brief Classe Frazione: numeri razionali con aritmetica esatta e constexpr
+*
+* Una Frazione è sempre mantenuta in forma normale:
+*  - denominatore > 0 (il segno sta nel numeratore);
+*  - numeratore e denominatore primi tra loro (lo zero vale 0/1).
+* Grazie alla forma normale due frazioni sono uguali se e solo se hanno
+* numeratore e denominatore uguali.
+*
+* Tutti i metodi (tranne stampa) sono constexpr: possono essere valutati
+* dal compilatore, ad esempio static_assert(Frazione(1, 2) + Frazione(1, 3) == Frazione(5, 6)).
+*
+* I calcoli intermedi sono eseguiti a 128 bit (__int128 di GCC/Clang): se il
+* risultato non è rappresentabile a 64 bit viene lanciata std::overflow_error.
+*
+* Compilazione: richiede C++20 (std::countr_zero), es. g++ -std=c++20
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 2.0 18/10/2026 MCD binario, operatori aritmetici e di confronto
+*/
+#ifndef FRAZIONE_H
+#define FRAZIONE_H
+
+#include <bit>         // std::countr_zero
+#include <compare>     // std::strong_ordering
+#include <cstdint>     // int64_t, uint64_t
+#include <iostream>    // cout, ostream
+#include <stdexcept>   // overflow_error, invalid_argument, domain_error
+
+/**
+ * @class Frazione
+ * @brief Numero razionale numeratore/denominatore a 64 bit
+ */
+class Frazione {
+private:
+	// Definizione degli attributi di classe
+	int64_t numeratore;
+	int64_t denominatore;
+
+	/// Costruttore privato per risultati già in forma normale (nessun MCD)
+	struct FormaNormale {};
+	constexpr Frazione(int64_t n, int64_t d, FormaNormale) : numeratore(n), denominatore(d) {}
+
+	/// Converte un intermedio a 128 bit controllando che stia in 64 bit
+	static constexpr int64_t a64bit(__int128 x) {
+		if (x < INT64_MIN || x > INT64_MAX) {
+			throw std::overflow_error("Frazione: risultato non rappresentabile a 64 bit");
+		}
+		return static_cast<int64_t>(x);
+	}
+
+	/// Valore assoluto senza overflow (anche per INT64_MIN)
+	static constexpr uint64_t modulo(__int128 x) {
+		return static_cast<uint64_t>(x < 0 ? -x : x);
+	}
+
+public:
+	/// Costruttore di default: la frazione 0/1
+	constexpr Frazione() : numeratore(0), denominatore(1) {}
+
+	/**
+	 * @brief Crea la frazione n/d e la semplifica
+	 * @throw std::invalid_argument se d vale 0
+	 */
+	constexpr Frazione(int64_t n, int64_t d = 1) : numeratore(n), denominatore(d) {
+		if (d == 0) {
+			throw std::invalid_argument("Frazione: denominatore nullo");
+		}
+		semplifica();
+	}
+
+	// Metodi setters: la frazione viene subito riportata in forma normale
+	constexpr void setNumeratore(int64_t n) {
+		*this = Frazione(n, denominatore);
+	}
+
+	constexpr void setDenominatore(int64_t d) {
+		*this = Frazione(numeratore, d);
+	}
+
+	// Metodi getters
+	constexpr int64_t getNumeratore() const {
+		return numeratore;
+	}
+
+	constexpr int64_t getDenominatore() const {
+		return denominatore;
+	}
+
+	/**
+	 * @brief Porta la frazione in forma normale (denominatore positivo, MCD = 1)
+	 * @throw std::overflow_error per -INT64_MIN (non rappresentabile)
+	 */
+	constexpr void semplifica() {
+		uint64_t mcd = MCD(modulo(numeratore), modulo(denominatore));
+		__int128 n = numeratore / static_cast<__int128>(mcd);
+		__int128 d = denominatore / static_cast<__int128>(mcd);
+		if (d < 0) {
+			n = -n;
+			d = -d;
+		}
+		numeratore = a64bit(n);
+		denominatore = a64bit(d);
+	}
+
+	/**
+	 * @brief MCD con l'algoritmo binario di Stein
+	 *
+	 * Al posto delle divisioni dell'algoritmo di Euclide usa solo shift e
+	 * sottrazioni: std::countr_zero conta gli zeri finali (una sola istruzione
+	 * macchina, tzcnt/bsf su x86) e permette di togliere tutti i fattori 2
+	 * con un unico shift. Per convenzione MCD(0, b) = b.
+	 */
+	static constexpr uint64_t MCD(uint64_t a, uint64_t b) {
+		if (a == 0) return b;
+		if (b == 0) return a;
+		int k = std::countr_zero(a | b);   // fattori 2 comuni
+		a >>= std::countr_zero(a);
+		int zb = std::countr_zero(b);
+		for (;;) {
+			b >>= zb;                      // a e b ora sono dispari
+			if (a == b) break;
+			// differenza di due dispari: pari. Gli zeri finali della differenza
+			// si contano subito, senza aspettare il confronto tra a e b
+			uint64_t diff = a > b ? a - b : b - a;
+			zb = std::countr_zero(diff);
+			a = a < b ? a : b;
+			b = diff;
+		}
+		return a << k;
+	}
+
+	/// Reciproco d/n
+	constexpr Frazione reciproco() const {
+		if (numeratore == 0) {
+			throw std::domain_error("Frazione: divisione per zero");
+		}
+		if (numeratore < 0) {
+			return Frazione(a64bit(-static_cast<__int128>(denominatore)),
+			                a64bit(-static_cast<__int128>(numeratore)), FormaNormale{});
+		}
+		return Frazione(denominatore, numeratore, FormaNormale{});
+	}
+
+	// Operatori aritmetici: il risultato è sempre in forma normale
+	constexpr Frazione operator-() const {
+		return Frazione(a64bit(-static_cast<__int128>(numeratore)), denominatore, FormaNormale{});
+	}
+
+	/**
+	 * a/b + c/d calcolato con il minimo comune multiplo dei denominatori:
+	 * con g = MCD(b, d) il risultato è (a*(d/g) + c*(b/g)) / (b/g*d) e
+	 * l'unico fattore comune possibile tra numeratore e denominatore divide g
+	 * (Knuth, TAOCP vol. 2, 4.5.1): basta un MCD su numeri piccoli.
+	 */
+	friend constexpr Frazione operator+(const Frazione &x, const Frazione &y) {
+		uint64_t g = MCD(x.denominatore, y.denominatore);
+		int64_t xd = x.denominatore / static_cast<int64_t>(g);
+		int64_t yd = y.denominatore / static_cast<int64_t>(g);
+		__int128 t = static_cast<__int128>(x.numeratore) * yd + static_cast<__int128>(y.numeratore) * xd;
+		if (t == 0) return Frazione();
+		uint64_t g2 = g == 1 ? 1 : MCD(modulo(t % g), g);
+		return Frazione(a64bit(t / g2), a64bit(static_cast<__int128>(xd) * (y.denominatore / static_cast<int64_t>(g2))),
+		                FormaNormale{});
+	}
+
+	friend constexpr Frazione operator-(const Frazione &x, const Frazione &y) {
+		return x + (-y);
+	}
+
+	/**
+	 * a/b * c/d: si semplificano a con d e c con b prima di moltiplicare,
+	 * così il prodotto è già in forma normale e gli intermedi restano piccoli.
+	 */
+	friend constexpr Frazione operator*(const Frazione &x, const Frazione &y) {
+		if (x.numeratore == 0 || y.numeratore == 0) return Frazione();
+		int64_t g1 = static_cast<int64_t>(MCD(modulo(x.numeratore), y.denominatore));
+		int64_t g2 = static_cast<int64_t>(MCD(modulo(y.numeratore), x.denominatore));
+		__int128 n = static_cast<__int128>(x.numeratore / g1) * (y.numeratore / g2);
+		__int128 d = static_cast<__int128>(x.denominatore / g2) * (y.denominatore / g1);
+		return Frazione(a64bit(n), a64bit(d), FormaNormale{});
+	}
+
+	friend constexpr Frazione operator/(const Frazione &x, const Frazione &y) {
+		return x * y.reciproco();
+	}
+
+	constexpr Frazione &operator+=(const Frazione &y) { return *this = *this + y; }
+	constexpr Frazione &operator-=(const Frazione &y) { return *this = *this - y; }
+	constexpr Frazione &operator*=(const Frazione &y) { return *this = *this * y; }
+	constexpr Frazione &operator/=(const Frazione &y) { return *this = *this / y; }
+
+	// Operatori di confronto (==, != generati dal compilatore; <, <=, >, >= da <=>)
+	friend constexpr bool operator==(const Frazione &x, const Frazione &y) = default;
+
+	/// a/b <=> c/d confrontando a*d e c*b (denominatori positivi, nessun overflow a 128 bit)
+	friend constexpr std::strong_ordering operator<=>(const Frazione &x, const Frazione &y) {
+		__int128 sx = static_cast<__int128>(x.numeratore) * y.denominatore;
+		__int128 dx = static_cast<__int128>(y.numeratore) * x.denominatore;
+		return sx < dx ? std::strong_ordering::less
+		     : sx > dx ? std::strong_ordering::greater
+		               : std::strong_ordering::equal;
+	}
+
+	/// Valore approssimato in virgola mobile
+	constexpr double valore() const {
+		return static_cast<double>(numeratore) / static_cast<double>(denominatore);
+	}
+
+	// Metodo che stampa a video la frazione
+	void stampa() const {
+		std::cout << numeratore << "/" << denominatore << std::endl;
+	}
+
+	friend std::ostream &operator<<(std::ostream &os, const Frazione &f) {
+		return os << f.numeratore << "/" << f.denominatore;
+	}
+};
+
+#endif
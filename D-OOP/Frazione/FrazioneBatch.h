@@ -0,0 +1,232 @@
+/** ****************************************************************************************
+* @file FrazioneBatch.h
+* @brief Elaborazione "in blocco" di grandi quantità di frazioni
+*
+* Un vector<Frazione> memorizza le frazioni una dopo l'altra (array di strutture):
+* num, den, num, den, ... e ogni operazione (+, semplifica) calcola subito un MCD.
+* FrazioneBatch invece usa due array separati (struttura di array, SoA):
+*   numeratori:   n0 n1 n2 ...
+*   denominatori: d0 d1 d2 ...
+* I cicli leggono memoria contigua e quelli senza salti condizionali (come la
+* correzione dei segni in semplificaTutte) vengono vettorizzati dal compilatore.
+*
+* La somma usa la "normalizzazione pigra": il risultato parziale viene tenuto
+* a 128 bit senza semplificarlo e l'MCD si calcola solo quando la moltiplicazione
+* successiva rischierebbe di superare i 128 bit. Se i denominatori sono uguali
+* (caso tipico: percentuali, importi in centesimi) si sommano solo i numeratori.
+*
+* Compilazione: richiede C++20, es. g++ -std=c++20
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef FRAZIONE_BATCH_H
+#define FRAZIONE_BATCH_H
+
+#include <bit>         // std::countl_zero, std::countr_zero
+#include <cstdint>     // int64_t, uint64_t
+#include <stdexcept>   // overflow_error, invalid_argument
+#include <vector>      // vector
+#include "Frazione.h"
+
+/**
+ * @class FrazioneBatch
+ * @brief Contenitore di frazioni in formato struttura di array
+ *
+ * Le frazioni aggiunte non vengono semplificate: lo si fa tutte insieme con
+ * semplificaTutte() oppure non lo si fa affatto se servono solo somme.
+ */
+class FrazioneBatch {
+private:
+	std::vector<int64_t> numeratori;
+	std::vector<int64_t> denominatori;
+
+	/// Numero di bit significativi di |x|
+	static int bit128(unsigned __int128 x) {
+		uint64_t alto = static_cast<uint64_t>(x >> 64);
+		return alto ? 128 - std::countl_zero(alto) : 64 - std::countl_zero(static_cast<uint64_t>(x));
+	}
+
+	static unsigned __int128 modulo128(__int128 x) {
+		return static_cast<unsigned __int128>(x < 0 ? -x : x);
+	}
+
+	static int zeriFinali128(unsigned __int128 x) {
+		uint64_t basso = static_cast<uint64_t>(x);
+		return basso ? std::countr_zero(basso) : 64 + std::countr_zero(static_cast<uint64_t>(x >> 64));
+	}
+
+	/// MCD binario (Stein) a 128 bit, stessa struttura di Frazione::MCD
+	static unsigned __int128 MCD128(unsigned __int128 a, unsigned __int128 b) {
+		if (a == 0) return b;
+		if (b == 0) return a;
+		int k = zeriFinali128(a | b);
+		a >>= zeriFinali128(a);
+		do {
+			b >>= zeriFinali128(b);
+			if (a > b) {
+				unsigned __int128 t = a;
+				a = b;
+				b = t;
+			}
+			b -= a;
+		} while (b != 0);
+		return a << k;
+	}
+
+	/// Semplifica la frazione parziale n/d (d > 0) a 128 bit
+	static void riduci(__int128 &n, __int128 &d) {
+		__int128 g = static_cast<__int128>(MCD128(modulo128(n), static_cast<unsigned __int128>(d)));
+		n /= g;
+		d /= g;
+	}
+
+public:
+	/// Aggiunge una frazione già normalizzata
+	void aggiungi(const Frazione &f) {
+		numeratori.push_back(f.getNumeratore());
+		denominatori.push_back(f.getDenominatore());
+	}
+
+	/**
+	 * @brief Aggiunge n/d così com'è, senza semplificarla
+	 * @throw std::invalid_argument se d vale 0
+	 */
+	void aggiungi(int64_t n, int64_t d) {
+		if (d == 0) {
+			throw std::invalid_argument("FrazioneBatch: denominatore nullo");
+		}
+		numeratori.push_back(n);
+		denominatori.push_back(d);
+	}
+
+	size_t size() const {
+		return numeratori.size();
+	}
+
+	void reserve(size_t n) {
+		numeratori.reserve(n);
+		denominatori.reserve(n);
+	}
+
+	/// Frazione i-esima (in forma normale)
+	Frazione operator[](size_t i) const {
+		return Frazione(numeratori[i], denominatori[i]);
+	}
+
+	const std::vector<int64_t> &getNumeratori() const {
+		return numeratori;
+	}
+
+	const std::vector<int64_t> &getDenominatori() const {
+		return denominatori;
+	}
+
+	/**
+	 * @brief Porta tutte le frazioni in forma normale
+	 * @throw std::overflow_error se una frazione contiene INT64_MIN e va cambiata di segno
+	 *        (denominatore negativo); in quel caso nessuna frazione viene modificata
+	 *
+	 * Primo passaggio: solo controllo del caso INT64_MIN con denominatore negativo.
+	 * Secondo passaggio: denominatori positivi (ciclo senza salti, vettorizzabile).
+	 * Terzo passaggio: un MCD binario per frazione, saltando quelle con
+	 * denominatore 1 che sono già in forma normale.
+	 */
+	void semplificaTutte() {
+		const size_t n = size();
+		int64_t *num = numeratori.data();
+		int64_t *den = denominatori.data();
+
+		bool minimo = false;
+		for (size_t i = 0; i < n; i++) {
+			minimo |= (den[i] < 0) & ((num[i] == INT64_MIN) | (den[i] == INT64_MIN));
+		}
+		if (minimo) {
+			throw std::overflow_error("FrazioneBatch: INT64_MIN da cambiare di segno");
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			int64_t segno = den[i] >> 63;          // 0 oppure -1
+			num[i] = (num[i] ^ segno) - segno;      // cambia segno se den < 0
+			den[i] = (den[i] ^ segno) - segno;
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			if (den[i] == 1) continue;
+			// modulo calcolato senza segno: vale anche per INT64_MIN
+			uint64_t modulo = num[i] < 0 ? 0 - static_cast<uint64_t>(num[i]) : static_cast<uint64_t>(num[i]);
+			uint64_t g = Frazione::MCD(modulo, den[i]);
+			if (g > 1) {
+				num[i] /= static_cast<int64_t>(g);
+				den[i] /= static_cast<int64_t>(g);
+			}
+		}
+	}
+
+	/**
+	 * @brief Somma esatta di tutte le frazioni con normalizzazione pigra
+	 * @return la somma in forma normale
+	 * @throw std::overflow_error se il risultato non è rappresentabile a 64 bit
+	 */
+	Frazione somma() const {
+		const size_t n = size();
+		const int64_t *num = numeratori.data();
+		const int64_t *den = denominatori.data();
+		__int128 sn = 0, sd = 1;   // somma parziale sn/sd, mai semplificata se non serve
+
+		size_t i = 0;
+		while (i < n) {
+			// Percorso veloce: serie di frazioni con lo stesso denominatore della
+			// somma parziale. Si sommano solo i numeratori: niente prodotti né MCD.
+			if (den[i] == sd) {
+				__int128 parziale = 0;
+				size_t j = i;
+				while (j < n && den[j] == sd && j - i < (1u << 20)) {
+					parziale += num[j];      // al massimo 2^20 * 2^63: non supera 2^84
+					j++;
+				}
+				if (__builtin_add_overflow(sn, parziale, &sn)) {
+					throw std::overflow_error("FrazioneBatch: somma troppo grande");
+				}
+				i = j;
+				continue;
+			}
+
+			__int128 d = den[i];
+			__int128 a = num[i];
+			if (d < 0) {
+				a = -a;
+				d = -d;
+			}
+			// sn/sd + a/d = (sn*d + a*sd) / (sd*d): controllo che gli intermedi stiano in 127 bit
+			int bd = bit128(static_cast<unsigned __int128>(d));
+			if (bit128(modulo128(sn)) + bd > 125 || bit128(modulo128(a)) + bit128(sd) > 125 ||
+			    bit128(sd) + bd > 126) {
+				riduci(sn, sd);             // overflow imminente: semplifico solo ora
+				// Uso il minimo comune multiplo dei denominatori
+				__int128 g = static_cast<__int128>(MCD128(static_cast<unsigned __int128>(sd),
+				                                          static_cast<unsigned __int128>(d)));
+				__int128 fs = d / g, fa = sd / g;
+				if (bit128(modulo128(sn)) + bit128(fs) > 125 || bit128(modulo128(a)) + bit128(fa) > 125 ||
+				    bit128(sd) + bit128(fs) > 126) {
+					throw std::overflow_error("FrazioneBatch: somma troppo grande");
+				}
+				sn = sn * fs + a * fa;
+				sd = sd * fs;
+			} else {
+				sn = sn * d + a * sd;
+				sd = sd * d;
+			}
+			i++;
+		}
+
+		riduci(sn, sd);
+		if (sn < INT64_MIN || sn > INT64_MAX || sd > INT64_MAX) {
+			throw std::overflow_error("FrazioneBatch: somma non rappresentabile a 64 bit");
+		}
+		return Frazione(static_cast<int64_t>(sn), static_cast<int64_t>(sd));
+	}
+};
+
+#endif
@@ -0,0 +1,127 @@
+/** ****************************************************************************************
+* @file bench_frazione.cpp
+* @brief Confronto di velocità: Frazione (MCD binario) e una versione "ingenua" con Euclide
+*
+* La versione ingenua somma con a*d + c*b / b*d e poi semplifica con
+* l'algoritmo di Euclide (una divisione per ogni passo), senza controlli di overflow.
+* Per ogni operazione si misura il numero di milioni di operazioni al secondo.
+*
+* Compilazione: g++ -std=c++20 -O2 bench_frazione.cpp -o bench_frazione
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>     // steady_clock
+#include <cstdint>    // int64_t
+#include <iostream>   // cout
+#include <random>     // mt19937_64
+#include <vector>     // vector
+#include "Frazione.h"
+
+using namespace std;
+
+/// Versione ingenua per il confronto: Euclide e nessuna ottimizzazione
+class FrazioneEuclide {
+public:
+	int64_t numeratore;
+	int64_t denominatore;
+
+	FrazioneEuclide(int64_t n = 0, int64_t d = 1) : numeratore(n), denominatore(d) {
+		semplifica();
+	}
+
+	static uint64_t MCD(uint64_t a, uint64_t b) { // algoritmo di Euclide
+		while (b != 0) {
+			uint64_t r = a % b;
+			a = b;
+			b = r;
+		}
+		return a;
+	}
+
+	void semplifica() {
+		int64_t mcd = MCD(numeratore < 0 ? -numeratore : numeratore, denominatore < 0 ? -denominatore : denominatore);
+		if (mcd == 0) return;
+		numeratore /= mcd;
+		denominatore /= mcd;
+		if (denominatore < 0) {
+			numeratore = -numeratore;
+			denominatore = -denominatore;
+		}
+	}
+
+	FrazioneEuclide operator+(const FrazioneEuclide &y) const {
+		return FrazioneEuclide(numeratore * y.denominatore + y.numeratore * denominatore, denominatore * y.denominatore);
+	}
+	FrazioneEuclide operator*(const FrazioneEuclide &y) const {
+		return FrazioneEuclide(numeratore * y.numeratore, denominatore * y.denominatore);
+	}
+	FrazioneEuclide operator/(const FrazioneEuclide &y) const {
+		return FrazioneEuclide(numeratore * y.denominatore, denominatore * y.numeratore);
+	}
+	bool operator<(const FrazioneEuclide &y) const {
+		return numeratore * y.denominatore < y.numeratore * denominatore;
+	}
+};
+
+/// Esegue op su tutte le coppie consecutive e restituisce i milioni di operazioni al secondo
+template <typename T, typename Op>
+double misura(const vector<T> &v, int ripetizioni, Op op, int64_t &controllo) {
+	auto inizio = chrono::steady_clock::now();
+	for (int r = 0; r < ripetizioni; r++) {
+		for (size_t i = 0; i + 1 < v.size(); i++) {
+			controllo += op(v[i], v[i + 1]);
+		}
+	}
+	chrono::duration<double> t = chrono::steady_clock::now() - inizio;
+	return ripetizioni * (v.size() - 1) / t.count() / 1e6;
+}
+
+int main() {
+	const size_t N = 1000000;
+	const int RIPETIZIONI = 5;
+	mt19937_64 gen(42);
+	// Numeratori e denominatori fino a 2^20: prodotti e somme restano a 64 bit
+	uniform_int_distribution<int64_t> num(-(1 << 20), 1 << 20), den(1, 1 << 20);
+
+	vector<Frazione> a;
+	vector<FrazioneEuclide> b;
+	for (size_t i = 0; i < N; i++) {
+		int64_t n = num(gen), d = den(gen);
+		if (n == 0) n = 1;
+		a.push_back(Frazione(n, d));
+		b.push_back(FrazioneEuclide(n, d));
+	}
+
+	int64_t ca = 0, cb = 0; // valori di controllo (impediscono al compilatore di eliminare i calcoli)
+	cout << "Milioni di operazioni al secondo (" << N << " coppie x " << RIPETIZIONI << ")\n";
+	cout << "operazione   Stein+128bit   Euclide\n";
+
+	double sa = misura(a, RIPETIZIONI, [](const Frazione &x, const Frazione &y) { return (x + y).getDenominatore(); }, ca);
+	double sb = misura(b, RIPETIZIONI, [](const FrazioneEuclide &x, const FrazioneEuclide &y) { return (x + y).denominatore; }, cb);
+	cout << "somma        " << sa << "        " << sb << "\n";
+
+	sa = misura(a, RIPETIZIONI, [](const Frazione &x, const Frazione &y) { return (x * y).getDenominatore(); }, ca);
+	sb = misura(b, RIPETIZIONI, [](const FrazioneEuclide &x, const FrazioneEuclide &y) { return (x * y).denominatore; }, cb);
+	cout << "prodotto     " << sa << "        " << sb << "\n";
+
+	sa = misura(a, RIPETIZIONI, [](const Frazione &x, const Frazione &y) { return (x / y).getDenominatore(); }, ca);
+	sb = misura(b, RIPETIZIONI, [](const FrazioneEuclide &x, const FrazioneEuclide &y) { return (x / y).denominatore; }, cb);
+	cout << "divisione    " << sa << "        " << sb << "\n";
+
+	sa = misura(a, RIPETIZIONI, [](const Frazione &x, const Frazione &y) { return int64_t(x < y); }, ca);
+	sb = misura(b, RIPETIZIONI, [](const FrazioneEuclide &x, const FrazioneEuclide &y) { return int64_t(x < y); }, cb);
+	cout << "confronto    " << sa << "        " << sb << "\n";
+
+	// Solo MCD su numeri casuali a 64 bit
+	vector<uint64_t> m(N);
+	for (auto &x : m) x = gen();
+	int64_t cm = 0;
+	double ma = misura(m, RIPETIZIONI, [](uint64_t x, uint64_t y) { return int64_t(Frazione::MCD(x, y)); }, cm);
+	double mb = misura(m, RIPETIZIONI, [](uint64_t x, uint64_t y) { return int64_t(FrazioneEuclide::MCD(x, y)); }, cm);
+	cout << "MCD 64 bit   " << ma << "        " << mb << "\n";
+
+	cout << "(controllo: " << ca << " " << cb << " " << cm << ")\n";
+	return 0;
+}
@@ -0,0 +1,84 @@
+/** ****************************************************************************************
+* @file bench_frazione_batch.cpp
+* @brief Confronto tra FrazioneBatch e l'uso di Frazione un oggetto alla volta
+*
+* Prove su 1 milione di frazioni:
+*  - semplificazione: Frazione(n, d) per ogni elemento (il costruttore chiama
+*    semplifica) contro FrazioneBatch::semplificaTutte();
+*  - somma con denominatori uguali (percentuali x/100);
+*  - somma con denominatori diversi (da 1 a 16).
+*
+* Compilazione: g++ -std=c++20 -O2 bench_frazione_batch.cpp -o bench_frazione_batch
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>     // steady_clock
+#include <iostream>   // cout
+#include <random>     // mt19937_64
+#include <vector>     // vector
+#include "FrazioneBatch.h"
+
+using namespace std;
+
+template <typename F>
+double misura(F f) {
+	auto inizio = chrono::steady_clock::now();
+	f();
+	chrono::duration<double, milli> t = chrono::steady_clock::now() - inizio;
+	return t.count();
+}
+
+void confronto(const char *titolo, const vector<int64_t> &num, const vector<int64_t> &den) {
+	const size_t N = num.size();
+	cout << "--- " << titolo << " ---\n";
+
+	// Semplificazione
+	vector<Frazione> oggetti(N);
+	double t1 = misura([&] {
+		for (size_t i = 0; i < N; i++) oggetti[i] = Frazione(num[i], den[i]);
+	});
+	FrazioneBatch batch;
+	batch.reserve(N);
+	for (size_t i = 0; i < N; i++) batch.aggiungi(num[i], den[i]);
+	double t2 = misura([&] { batch.semplificaTutte(); });
+	bool uguali = true;
+	for (size_t i = 0; i < N; i++) uguali = uguali && batch[i] == oggetti[i];
+	cout << "semplifica: Frazione " << t1 << " ms, FrazioneBatch " << t2 << " ms"
+	     << (uguali ? "" : "  ERRORE") << "\n";
+
+	// Somma
+	Frazione s1;
+	t1 = misura([&] {
+		for (size_t i = 0; i < N; i++) s1 += oggetti[i];
+	});
+	FrazioneBatch grezze;   // somma senza semplificare prima
+	grezze.reserve(N);
+	for (size_t i = 0; i < N; i++) grezze.aggiungi(num[i], den[i]);
+	Frazione s2;
+	t2 = misura([&] { s2 = grezze.somma(); });
+	cout << "somma:      Frazione " << t1 << " ms, FrazioneBatch " << t2 << " ms  = " << s2
+	     << (s1 == s2 ? "" : "  ERRORE") << "\n";
+}
+
+int main() {
+	const size_t N = 1000000;
+	mt19937_64 gen(7);
+	vector<int64_t> num(N), den(N);
+
+	uniform_int_distribution<int64_t> perc(0, 100);
+	for (size_t i = 0; i < N; i++) {
+		num[i] = perc(gen);
+		den[i] = 100;
+	}
+	confronto("percentuali x/100", num, den);
+
+	uniform_int_distribution<int64_t> n(-1000, 1000), d(1, 16);
+	for (size_t i = 0; i < N; i++) {
+		num[i] = n(gen);
+		den[i] = d(gen);
+	}
+	confronto("denominatori da 1 a 16", num, den);
+	return 0;
+}
@@ -0,0 +1,117 @@
+#include "Arduino.h"
+#include "GruppoLED.h"
+#include "Scheduler.h"
+
+constexpr TabellaGamma GruppoLED::GAMMA;
+
+GruppoLED::GruppoLED() {
+  _n = 0;
+  _attive = 0;
+  _ripeti = 0;
+  _ultimoAggiornamento = 0;
+  _task = Scheduler::NESSUN_TASK;
+}
+
+bool GruppoLED::aggiungi(LED &led) {
+  if(_n == MAX_LED_GRUPPO) return false;
+  _led[_n] = &led;
+  _livello[_n] = 0;
+  _n++;
+  return true;
+}
+
+bool GruppoLED::dissolvenza(LED &led, int luminosita, unsigned long durata, bool ripeti) {
+  int i = indice(led);
+  if(i < 0) return false;
+  uint32_t bit = (uint32_t)1 << i;
+  luminosita = luminosita > 255 ? 255 : (luminosita < 0 ? 0 : luminosita);
+
+  if(_attive == 0) _ultimoAggiornamento = millis();   // il gruppo era fermo
+  _inizio[i] = _livello[i] >> 16;
+  _fine[i] = luminosita;
+  if(durata == 0 || (_inizio[i] == _fine[i] && !ripeti)) {
+    _livello[i] = (uint32_t)luminosita << 16;
+    _attive &= ~bit;
+    scrivi(i);
+    return true;
+  }
+  _livello[i] = (uint32_t)_inizio[i] << 16;
+  _passo[i] = (int32_t)(((int32_t)_fine[i] - _inizio[i]) * 65536) / (int32_t)durata;
+  _durata[i] = durata;
+  _mancano[i] = durata;
+  _attive |= bit;
+  if(ripeti) _ripeti |= bit;
+  else _ripeti &= ~bit;
+  return true;
+}
+
+void GruppoLED::ferma(LED &led) {
+  int i = indice(led);
+  if(i >= 0) _attive &= ~((uint32_t)1 << i);
+}
+
+bool GruppoLED::attiva(LED &led) const {
+  int i = indice(led);
+  return i >= 0 && (_attive >> i & 1);
+}
+
+int GruppoLED::luminosita(LED &led) const {
+  int i = indice(led);
+  return i >= 0 ? (int)(_livello[i] >> 16) : 0;
+}
+
+void GruppoLED::aggiorna() {
+  uint32_t adesso = millis();
+  uint32_t trascorso = adesso - _ultimoAggiornamento;
+  if(trascorso == 0 || _attive == 0) return;
+  _ultimoAggiornamento = adesso;
+
+  uint32_t daAggiornare = _attive;
+  while(daAggiornare) {
+    int i = __builtin_ctzl(daAggiornare);  // indice del bit 1 più basso (ctz su AVR è a 16 bit)
+    daAggiornare &= daAggiornare - 1;
+    if(trascorso < _mancano[i]) {
+      _mancano[i] -= trascorso;
+      _livello[i] += _passo[i] * (int32_t)trascorso;
+    } else {
+      unsigned long resto = trascorso - _mancano[i];
+      _livello[i] = (uint32_t)_fine[i] << 16;   // arrivo esatto, senza errori di arrotondamento
+      if(_ripeti >> i & 1) {
+        // Si torna indietro, tenendo conto del tempo già trascorso dopo la fine
+        uint8_t t = _inizio[i];
+        _inizio[i] = _fine[i];
+        _fine[i] = t;
+        _passo[i] = -_passo[i];
+        resto %= _durata[i];
+        _mancano[i] = _durata[i] - resto;
+        _livello[i] += _passo[i] * (int32_t)resto;
+      } else {
+        _attive &= ~((uint32_t)1 << i);
+      }
+    }
+    scrivi(i);
+  }
+}
+
+void GruppoLED::avvia() {
+  if(scheduler.attivo(_task)) return;
+  _task = scheduler.ogni(PERIODO_DISSOLVENZE, aggiornaTask, this);
+}
+
+void GruppoLED::aggiornaTask(void *gruppo) {
+  ((GruppoLED *)gruppo)->aggiorna();
+}
+
+int GruppoLED::indice(LED &led) const {
+  for(int i=0; i<_n; i++) {
+    if(_led[i] == &led) return i;
+  }
+  return -1;
+}
+
+void GruppoLED::scrivi(int i) {
+  int duty = GAMMA.duty[_livello[i] >> 16];
+  if(duty != _led[i]->getLuminosita()) {
+    _led[i]->setLuminosita(duty);
+  }
+}
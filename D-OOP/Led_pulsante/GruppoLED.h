@@ -0,0 +1,112 @@
+/** ****************************************************************************************
+* @file GruppoLED.h
+* @brief Dissolvenze non bloccanti della luminosità di molti LED (fino a 32)
+*
+* Una dissolvenza porta un LED da una luminosità ad un'altra in un tempo dato
+* senza usare delay(): ad ogni aggiorna() il gruppo calcola in un'unica passata
+* il nuovo valore di tutti i LED con una dissolvenza in corso e scrive il PWM
+* solo se è cambiato. I LED fermi non costano nulla (maschera di bit come in
+* GruppoPulsanti).
+*
+* La luminosità è quella percepita (0-255): l'occhio non è lineare, quindi il
+* valore viene convertito nel duty cycle con una tabella di correzione gamma
+* (gamma 2.2) calcolata dal compilatore. Le interpolazioni usano numeri in
+* virgola fissa (16 bit di parte frazionaria): niente float né divisioni nel loop.
+* Il calcolo della tabella con constexpr richiede almeno C++14.
+*
+* Esempio:
+*   gruppo.aggiungi(led1);
+*   gruppo.dissolvenza(led1, 255, 2000);        // accensione graduale in 2 s
+*   gruppo.dissolvenza(led2, 255, 1500, true);  // "respira" finché non la si ferma
+*   gruppo.aggiorna();                          // in loop(), oppure gruppo.avvia()
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef GRUPPO_LED_H
+#define GRUPPO_LED_H
+
+#include <stdint.h>
+#include "LED.h"
+
+#define MAX_LED_GRUPPO 32
+#define PERIODO_DISSOLVENZE 10   // ms tra due aggiornamenti con avvia()
+
+/**
+ * @brief Tabella gamma: duty cycle (0-255) per ogni luminosità percepita (0-255)
+ *
+ * duty = 255 * (l / 255)^2.2, con x^2.2 = x^2 * radice quinta di x
+ * (radice calcolata con il metodo di Newton).
+ */
+struct TabellaGamma {
+  uint8_t duty[256];
+
+  constexpr TabellaGamma() : duty() {
+    for (int l = 0; l < 256; l++) {
+      double x = l / 255.0;
+      double r = 1;
+      for (int i = 0; i < 40 && x > 0; i++) {
+        r = (4 * r + x / (r * r * r * r)) / 5;
+      }
+      duty[l] = (uint8_t)(255 * x * x * (x > 0 ? r : 0) + 0.5);
+    }
+  }
+};
+
+class GruppoLED {
+  public:
+    static constexpr TabellaGamma GAMMA = TabellaGamma();
+
+    GruppoLED();
+
+    /**
+    * @brief Aggiunge un LED al gruppo (luminosità iniziale 0)
+    * @return false se il gruppo è pieno
+    */
+    bool aggiungi(LED &led);
+
+    /**
+    * @brief Avvia una dissolvenza dalla luminosità attuale a quella finale
+    * @param luminosita luminosità percepita finale (0-255)
+    * @param durata in ms; 0 = imposta subito la luminosità
+    * @param ripeti true = torna indietro e ricomincia finché non si chiama ferma()
+    * @return false se il LED non appartiene al gruppo
+    */
+    bool dissolvenza(LED &led, int luminosita, unsigned long durata, bool ripeti = false);
+
+    /// Interrompe la dissolvenza lasciando la luminosità raggiunta
+    void ferma(LED &led);
+
+    /// true se il LED ha una dissolvenza in corso
+    bool attiva(LED &led) const;
+
+    /// Luminosità percepita attuale (0-255)
+    int luminosita(LED &led) const;
+
+    /// Da chiamare ad ogni giro di loop(): non blocca mai
+    void aggiorna();
+
+    /// Chiama aggiorna() ogni PERIODO_DISSOLVENZE ms con lo scheduler globale (una volta sola)
+    void avvia();
+
+  private:
+    LED *_led[MAX_LED_GRUPPO];
+    int _n;
+    uint32_t _attive;                  // bit i = 1: dissolvenza in corso sul LED i
+    uint32_t _ripeti;
+    uint32_t _livello[MAX_LED_GRUPPO]; // luminosità percepita << 16
+    int32_t _passo[MAX_LED_GRUPPO];    // variazione di _livello per ms
+    uint8_t _inizio[MAX_LED_GRUPPO];
+    uint8_t _fine[MAX_LED_GRUPPO];
+    unsigned long _durata[MAX_LED_GRUPPO];
+    unsigned long _mancano[MAX_LED_GRUPPO];   // ms alla fine della dissolvenza
+    uint32_t _ultimoAggiornamento;
+    int _task;                         // task dello scheduler registrato da avvia()
+
+    int indice(LED &led) const;
+    void scrivi(int i);
+    static void aggiornaTask(void *gruppo);
+};
+
+#endif
@@ -0,0 +1,55 @@
+#include "Arduino.h"
+#include "GruppoPulsanti.h"
+#include "Scheduler.h"
+
+GruppoPulsanti::GruppoPulsanti() {
+  _n = 0;
+  _temporizzati = 0;
+  _ultimaLettura = 0;
+  _task = Scheduler::NESSUN_TASK;
+}
+
+bool GruppoPulsanti::aggiungi(Pulsante &p) {
+  if(_n == MAX_PULSANTI_GRUPPO) return false;
+  _pulsanti[_n++] = &p;
+  return true;
+}
+
+void GruppoPulsanti::aggiorna() {
+  uint32_t adesso = millis();
+  uint32_t fronti = 0;
+  if(adesso - _ultimaLettura >= PERIODO_CAMPIONAMENTO) {
+    _ultimaLettura = adesso;
+    // Su AVR/ESP32 si potrebbero leggere direttamente i registri delle porte
+    uint32_t lettura = 0;
+    for(int i=0; i<_n; i++) {
+      lettura |= (uint32_t)_pulsanti[i]->press() << i;
+    }
+    fronti = _antirimbalzo.aggiorna(lettura);
+  }
+
+  // Solo i pulsanti con un fronte o con un tempo da controllare
+  uint32_t daElaborare = fronti | _temporizzati;
+  while(daElaborare) {
+    int i = __builtin_ctzl(daElaborare);  // indice del bit 1 più basso (ctz su AVR è a 16 bit)
+    daElaborare &= daElaborare - 1;
+    uint32_t bit = (uint32_t)1 << i;
+    Pulsante *p = _pulsanti[i];
+    p->elabora((fronti & bit) != 0, adesso);
+    if(p->temporizzato()) _temporizzati |= bit;
+    else _temporizzati &= ~bit;
+  }
+}
+
+void GruppoPulsanti::avvia() {
+  if(scheduler.attivo(_task)) return;
+  _task = scheduler.ogni(PERIODO_CAMPIONAMENTO, aggiornaTask, this);
+}
+
+void GruppoPulsanti::aggiornaTask(void *gruppo) {
+  ((GruppoPulsanti *)gruppo)->aggiorna();
+}
+
+uint32_t GruppoPulsanti::premuti() const {
+  return _antirimbalzo.stabile;
+}
@@ -0,0 +1,55 @@
+/** ****************************************************************************************
+* @file GruppoPulsanti.h
+* @brief Gestione di molti pulsanti (fino a 32) con un'unica passata di antirimbalzo
+*
+* Invece di chiamare aggiorna() su ogni Pulsante, i pulsanti si aggiungono ad un
+* gruppo: ogni PERIODO_CAMPIONAMENTO ms il gruppo legge tutti i pin in una
+* parola a 32 bit ed esegue l'antirimbalzo di tutti i pulsanti con poche
+* operazioni sui bit (vedi Antirimbalzo in Pulsante.h). La macchina a stati
+* degli eventi viene elaborata solo per i pulsanti che hanno avuto un fronte
+* o che stanno misurando un tempo (click, doppio click, pressione lunga):
+* con i pulsanti a riposo un giro di loop costa le sole letture dei pin.
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef GRUPPO_PULSANTI_H
+#define GRUPPO_PULSANTI_H
+
+#include <stdint.h>
+#include "Pulsante.h"
+
+#define MAX_PULSANTI_GRUPPO 32
+
+class GruppoPulsanti {
+  public:
+    GruppoPulsanti();
+
+    /**
+    * @brief Aggiunge un pulsante al gruppo
+    * @return false se il gruppo è pieno
+    */
+    bool aggiungi(Pulsante &p);
+
+    /// Da chiamare ad ogni giro di loop(): non blocca mai
+    void aggiorna();
+
+    /// Chiama aggiorna() periodicamente con lo scheduler globale (una volta sola)
+    void avvia();
+
+    /// Bit i = 1 se il pulsante i-esimo è premuto (dopo l'antirimbalzo)
+    uint32_t premuti() const;
+
+  private:
+    Pulsante *_pulsanti[MAX_PULSANTI_GRUPPO];
+    int _n;
+    Antirimbalzo _antirimbalzo;
+    uint32_t _temporizzati;   // pulsanti con la macchina a stati fuori da RIPOSO
+    uint32_t _ultimaLettura;
+    int _task;                // task dello scheduler registrato da avvia()
+
+    static void aggiornaTask(void *gruppo);
+};
+
+#endif
@@ -1,9 +1,13 @@
 #include "Arduino.h"
 #include "LED.h"
+#include "Scheduler.h"
 
 LED::LED(int pin) {
   _pin = pin;
   _stato = false;
+  _luminosita = 0;
+  _task = Scheduler::NESSUN_TASK;
+  _inversioni = 0;
   pinMode(_pin, OUTPUT);
 }
 
@@ -43,8 +47,7 @@ void LED::lampeggia(int nr, int ritardo) {
 }
 
 void LED::setLuminosita(int luminosita) {
-  _luminosita = luminosita > 255 ? 255 : luminosita;
-  _luminosita = luminosita < 0 ? 0 : luminosita;
+  _luminosita = luminosita > 255 ? 255 : (luminosita < 0 ? 0 : luminosita);
   analogWrite(_pin, _luminosita);
 }
 
@@ -57,7 +60,7 @@ void LED::test(int nr) {
     lampeggia(3);
   } else if(nr==3) {
     lampeggia(3,100);
-    for(int lum=0; lum<1023; lum+=64) {
+    for(int lum=0; lum<=255; lum+=16) {
       setLuminosita(lum);
       delay(300);
     }
@@ -65,4 +68,35 @@ void LED::test(int nr) {
   } else {
     lampeggia(4,100);
   }
-}
\ No newline at end of file
+}
+
+void LED::avviaLampeggio(int nr, unsigned long ritardo) {
+  fermaLampeggio();
+  _inversioni = nr > 0 ? 2 * nr - 1 : -1;
+  accendi();
+  _task = scheduler.ogni(ritardo, passoLampeggio, this);
+}
+
+void LED::fermaLampeggio() {
+  if (scheduler.annulla(_task)) {
+    spegni();
+  }
+  _task = Scheduler::NESSUN_TASK;
+}
+
+bool LED::staLampeggiando() {
+  return scheduler.attivo(_task);
+}
+
+void LED::passoLampeggio(void *led) {
+  LED *l = (LED *)led;
+  l->inverti();
+  if (l->_inversioni > 0 && --l->_inversioni == 0) {
+    scheduler.annulla(l->_task);
+    l->_task = Scheduler::NESSUN_TASK;
+  }
+}
+
+int LED::getLuminosita() {
+  return _luminosita;
+}
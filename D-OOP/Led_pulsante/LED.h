@@ -47,10 +47,17 @@ class LED {
       void lampeggia(int nr);
       void lampeggia(int nr, int ritardo);
       /** ****************************************************************************************
-      * @todo Da testare
+      * @brief Imposta il duty cycle del PWM (analogWrite)
+      * @param luminosita 0 = spento, 255 = massima; i valori fuori intervallo vengono limitati
       * @version 1.0 26/02/23 Versione iniziale
+      * @version 1.2 18/10/2026 Corretta la limitazione a 0-255
       */
       void setLuminosita(int luminosita);
+      /**
+      * @brief Ultimo valore impostato con setLuminosita()
+      * @version 1.2 18/10/2026
+      */
+      int getLuminosita();
       /** ****************************************************************************************
       * @brief Test dei metodi della classe
       * @param  test da eseguire
@@ -60,11 +67,34 @@ class LED {
       * @version 1.0 26/02/23 Versione iniziale
       */
       void test(int nr);
+      /**
+      * @brief Avvia nr lampeggi senza bloccare il loop (usa lo scheduler globale)
+      * @param nr numero di lampeggi, 0 = lampeggia finché non si chiama fermaLampeggio()
+      * @param ritardo durata in ms della fase accesa e di quella spenta
+      *
+      * Richiede che loop() chiami scheduler.esegui().
+      * @version 1.1 18/10/2026 Versione non bloccante di lampeggia()
+      */
+      void avviaLampeggio(int nr, unsigned long ritardo = 500);
+      /**
+      * @brief Interrompe il lampeggio e spegne il LED
+      * @version 1.1 18/10/2026
+      */
+      void fermaLampeggio();
+      /**
+      * @brief true se è in corso un lampeggio avviato con avviaLampeggio()
+      * @version 1.1 18/10/2026
+      */
+      bool staLampeggiando();
 
    private:
       int _pin;
       bool _stato;
       int _luminosita; //0-255 0-spento, 255-max luminosità
+      int _task;       //task dello scheduler che esegue il lampeggio
+      int _inversioni; //inversioni che mancano alla fine del lampeggio, -1 = infinite
+
+      static void passoLampeggio(void *led);
    
 };
 
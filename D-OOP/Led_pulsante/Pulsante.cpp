@@ -1,8 +1,18 @@
 #include "Arduino.h"
 #include "Pulsante.h"
+#include "Scheduler.h"
 
 Pulsante::Pulsante(int pin) {
   _pin = pin;
+  _ultimaLettura = 0;
+  _inizio = 0;
+  _fase = RIPOSO;
+  _lungaSegnalata = false;
+  _click = false;
+  _task = Scheduler::NESSUN_TASK;
+  for(int i=0; i<NUM_EVENTI_PULSANTE; i++) {
+    _funzione[i] = 0;
+  }
   pinMode(_pin, INPUT_PULLUP);
 }
 
@@ -38,3 +48,108 @@ void Pulsante::test(int numero_test) {
       break;
   }
 }
+
+void Pulsante::aggiorna() {
+  uint32_t adesso = millis();
+  bool fronte = false;
+  if(adesso - _ultimaLettura >= PERIODO_CAMPIONAMENTO) {
+    _ultimaLettura = adesso;
+    fronte = _antirimbalzo.aggiorna(press() ? 1 : 0) != 0;
+  }
+  if(fronte || _fase != RIPOSO) {
+    elabora(fronte, adesso);
+  }
+}
+
+void Pulsante::avvia() {
+  if(scheduler.attivo(_task)) return;
+  _task = scheduler.ogni(PERIODO_CAMPIONAMENTO, aggiornaTask, this);
+}
+
+void Pulsante::aggiornaTask(void *pulsante) {
+  ((Pulsante *)pulsante)->aggiorna();
+}
+
+void Pulsante::suEvento(EventoPulsante e, FunzionePulsante f) {
+  _funzione[e] = f;
+}
+
+bool Pulsante::clickAvvenuto() {
+  bool c = _click;
+  _click = false;
+  return c;
+}
+
+bool Pulsante::premuto() const {
+  return _antirimbalzo.stabile & 1;
+}
+
+int Pulsante::getPin() const {
+  return _pin;
+}
+
+bool Pulsante::temporizzato() const {
+  return _fase != RIPOSO;
+}
+
+void Pulsante::genera(EventoPulsante e) {
+  if(e == CLICK) _click = true;
+  if(_funzione[e]) _funzione[e](*this);
+}
+
+/*
+ * Macchina a stati degli eventi (i fronti arrivano già senza rimbalzi):
+ *   RIPOSO          --pressione--> PREMUTO          [PRESSIONE]
+ *   PREMUTO         --rilascio---> ATTESA_SECONDO   [RILASCIO]
+ *                                  oppure RIPOSO    [RILASCIO, CLICK] se non serve il doppio click
+ *                                  oppure RIPOSO    [RILASCIO] dopo una PRESSIONE_LUNGA
+ *   PREMUTO         --800 ms-----> PREMUTO          [PRESSIONE_LUNGA] (una sola volta)
+ *   ATTESA_SECONDO  --300 ms-----> RIPOSO           [CLICK]
+ *   ATTESA_SECONDO  --pressione--> SECONDO_PREMUTO  [PRESSIONE]
+ *   SECONDO_PREMUTO --rilascio---> RIPOSO           [RILASCIO, DOPPIO_CLICK]
+ */
+void Pulsante::elabora(bool fronte, uint32_t adesso) {
+  switch(_fase) {
+    case RIPOSO:
+      if(fronte) {
+        _fase = PREMUTO;
+        _inizio = adesso;
+        _lungaSegnalata = false;
+        genera(PRESSIONE);
+      }
+      break;
+    case PREMUTO:
+      if(fronte) {
+        genera(RILASCIO);
+        if(_lungaSegnalata) {
+          _fase = RIPOSO;
+        } else if(_funzione[DOPPIO_CLICK] == 0) {
+          _fase = RIPOSO;
+          genera(CLICK);
+        } else {
+          _fase = ATTESA_SECONDO;
+          _inizio = adesso;
+        }
+      } else if(!_lungaSegnalata && adesso - _inizio >= TEMPO_PRESSIONE_LUNGA) {
+        _lungaSegnalata = true;
+        genera(PRESSIONE_LUNGA);
+      }
+      break;
+    case ATTESA_SECONDO:
+      if(fronte) {
+        _fase = SECONDO_PREMUTO;
+        genera(PRESSIONE);
+      } else if(adesso - _inizio >= TEMPO_DOPPIO_CLICK) {
+        _fase = RIPOSO;
+        genera(CLICK);
+      }
+      break;
+    case SECONDO_PREMUTO:
+      if(fronte) {
+        _fase = RIPOSO;
+        genera(RILASCIO);
+        genera(DOPPIO_CLICK);
+      }
+      break;
+  }
+}
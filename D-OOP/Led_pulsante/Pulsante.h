@@ -1,17 +1,66 @@
 /** ****************************************************************************************
 * @file Pulsante.H
-* @brief Versione base base della classe pulsante (bloccante)
-* il click non funziona perchè vengono rilevate falsi rilasci del pulsante
-* 
+* @brief Classe pulsante con antirimbalzo non bloccante ed eventi
+* La versione 1.0 (metodi press() e click(), ancora disponibili) è bloccante:
+* click() resta in attesa finché il pulsante non viene rilasciato e rileva i
+* falsi rilasci dovuti ai rimbalzi del contatto.
+*
+* Dalla versione 2.0 il pulsante va aggiornato ad ogni giro di loop() con
+* aggiorna() (oppure con avvia() e lo scheduler). aggiorna() non attende mai:
+* - ogni PERIODO_CAMPIONAMENTO ms legge il pin; il nuovo livello viene accettato
+*   solo dopo 4 letture uguali consecutive (antirimbalzo a "contatori verticali");
+* - una macchina a stati trasforma pressioni e rilasci in eventi: PRESSIONE,
+*   RILASCIO, CLICK, DOPPIO_CLICK e PRESSIONE_LUNGA, ognuno con la sua funzione
+*   registrata con suEvento().
+* Per molti pulsanti conviene GruppoPulsanti, che esegue l'antirimbalzo di
+* 32 pulsanti contemporaneamente con operazioni sui bit.
+*
 * https://wokwi.com/projects/357356804480899073
 *
 * @author Filippo Bilardo
 * @date 26/02/23
 * @version 1.0 26/02/23 Versione iniziale
+* @version 2.0 18/10/2026 Antirimbalzo non bloccante ed eventi
 */
 #ifndef PULSANTE_H
 #define PULSANTE_H
 
+#include <stdint.h>
+
+#define PERIODO_CAMPIONAMENTO 5   // ms tra due letture del pin
+#define TEMPO_DOPPIO_CLICK 300    // ms massimi tra rilascio e seconda pressione
+#define TEMPO_PRESSIONE_LUNGA 800 // ms di pressione per PRESSIONE_LUNGA
+
+enum EventoPulsante { PRESSIONE, RILASCIO, CLICK, DOPPIO_CLICK, PRESSIONE_LUNGA, NUM_EVENTI_PULSANTE };
+
+class Pulsante;
+typedef void (*FunzionePulsante)(Pulsante &p);
+
+/**
+ * @brief Antirimbalzo di 32 ingressi in parallelo (un bit per ingresso)
+ *
+ * Ogni bit ha un contatore a 2 bit "verticale": i bit bassi dei 32 contatori
+ * stanno in c0, quelli alti in c1. Quando la lettura differisce dallo stato
+ * stabile il contatore avanza, altrimenti si azzera; dopo 4 letture diverse
+ * consecutive lo stato stabile cambia. Poche operazioni logiche aggiornano
+ * tutti i 32 ingressi insieme.
+ */
+struct Antirimbalzo {
+  uint32_t stabile = 0;   // 1 = premuto
+  uint32_t c0 = 0xFFFFFFFF;
+  uint32_t c1 = 0xFFFFFFFF;
+
+  /// Elabora una lettura (1 = premuto); restituisce i bit il cui stato stabile è cambiato
+  uint32_t aggiorna(uint32_t lettura) {
+    uint32_t diverso = stabile ^ lettura;
+    c0 = ~(c0 & diverso);
+    c1 = c0 ^ (c1 & diverso);
+    uint32_t cambiati = diverso & c0 & c1;
+    stabile ^= cambiati;
+    return cambiati;
+  }
+};
+
 class Pulsante {
   public:
     /**
@@ -49,8 +98,71 @@ class Pulsante {
     */
     void test(int numero_test);
 
+    /**
+    * @brief Legge il pulsante (se è passato PERIODO_CAMPIONAMENTO) e genera gli eventi
+    *
+    * Non blocca mai: va chiamato ad ogni giro di loop().
+    * @version 2.0 18/10/2026
+    */
+    void aggiorna();
+
+    /**
+    * @brief Chiama aggiorna() periodicamente con lo scheduler globale
+    *
+    * Richiede che loop() chiami scheduler.esegui(). Chiamarla di nuovo mentre
+    * il task è attivo non registra un secondo task.
+    * @version 2.0 18/10/2026
+    */
+    void avvia();
+
+    /**
+    * @brief Registra la funzione da chiamare quando si verifica l'evento e (0 = nessuna)
+    *
+    * Se nessuna funzione è registrata per DOPPIO_CLICK, CLICK viene generato
+    * subito al rilascio invece di attendere TEMPO_DOPPIO_CLICK.
+    * @version 2.0 18/10/2026
+    */
+    void suEvento(EventoPulsante e, FunzionePulsante f);
+
+    /**
+    * @brief Versione non bloccante di click()
+    * @return true una sola volta dopo ogni evento CLICK
+    * @version 2.0 18/10/2026
+    */
+    bool clickAvvenuto();
+
+    /// Stato del pulsante dopo l'antirimbalzo (se aggiornato con aggiorna(); in un gruppo usare GruppoPulsanti::premuti())
+    bool premuto() const;
+
+    int getPin() const;
+
+    /**
+    * @brief Fa avanzare la macchina a stati degli eventi
+    * @param fronte true se lo stato stabile del pulsante è appena cambiato
+    * @param adesso millis() attuale
+    *
+    * Usata da aggiorna() e da GruppoPulsanti, che fa l'antirimbalzo per conto suo.
+    */
+    void elabora(bool fronte, uint32_t adesso);
+
+    /// true se la macchina a stati deve essere elaborata anche senza fronti (sta misurando un tempo)
+    bool temporizzato() const;
+
   private:
+    enum Fase { RIPOSO, PREMUTO, ATTESA_SECONDO, SECONDO_PREMUTO };
+
     int _pin;
+    Antirimbalzo _antirimbalzo;            // usato solo il bit 0
+    uint32_t _ultimaLettura;               // a 32 bit come millis() su AVR
+    uint32_t _inizio;                      // istante dell'ultimo fronte
+    Fase _fase;
+    bool _lungaSegnalata;
+    bool _click;                           // CLICK non ancora consumato da clickAvvenuto()
+    int _task;                             // task dello scheduler registrato da avvia()
+    FunzionePulsante _funzione[NUM_EVENTI_PULSANTE];
+
+    void genera(EventoPulsante e);
+    static void aggiornaTask(void *pulsante);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "Arduino.h"
+#include "Scheduler.h"
+
+Scheduler scheduler;
+
+Scheduler::Scheduler() {
+  _n = 0;
+  for(int i=0; i<SCHEDULER_MAX_TASK; i++) {
+    _posizione[i] = -1;
+  }
+}
+
+int Scheduler::dopo(unsigned long ritardo, FunzioneTask f, void *dato) {
+  return registra(ritardo, 0, f, dato);
+}
+
+// periodo 0 per registra() vuol dire "una volta sola": qui è un errore
+int Scheduler::ogni(unsigned long periodo, FunzioneTask f, void *dato) {
+  if(periodo == 0) return NESSUN_TASK;
+  return registra(periodo, periodo, f, dato);
+}
+
+int Scheduler::registra(unsigned long ritardo, unsigned long periodo, FunzioneTask f, void *dato) {
+  int id = 0;
+  while(id < SCHEDULER_MAX_TASK && _posizione[id] != -1) id++;
+  if(id == SCHEDULER_MAX_TASK || f == 0) return NESSUN_TASK;
+
+  _task[id].scadenza = (uint32_t)millis() + (uint32_t)ritardo;
+  _task[id].periodo = (uint32_t)periodo;
+  _task[id].funzione = f;
+  _task[id].dato = dato;
+  _heap[_n] = id;
+  _posizione[id] = _n;
+  _n++;
+  sali(_n - 1);
+  return id;
+}
+
+bool Scheduler::annulla(int id) {
+  if(!attivo(id)) return false;
+  rimuovi(_posizione[id]);
+  return true;
+}
+
+bool Scheduler::attivo(int id) const {
+  return id >= 0 && id < SCHEDULER_MAX_TASK && _posizione[id] != -1;
+}
+
+int Scheduler::esegui() {
+  int eseguiti = 0;
+  // Al massimo un giro per task: un task periodico in ritardo non blocca il loop
+  for(int giri = _n; giri > 0 && _n > 0; giri--) {
+    int id = _heap[0];
+    Task &t = _task[id];
+    // Confronto con la differenza: corretto anche quando millis() riparte da 0 (dopo ~49 giorni)
+    if((int32_t)((uint32_t)millis() - t.scadenza) < 0) break;
+
+    FunzioneTask f = t.funzione;
+    void *dato = t.dato;
+    if(t.periodo == 0) {
+      rimuovi(0);               // prima di chiamare f, che può registrare altri task
+    } else {
+      t.scadenza += t.periodo;
+      scendi(0);
+    }
+    f(dato);
+    eseguiti++;
+  }
+  return eseguiti;
+}
+
+unsigned long Scheduler::attesa() const {
+  if(_n == 0) return 0xFFFFFFFFUL;
+  int32_t mancano = (int32_t)(_task[_heap[0]].scadenza - (uint32_t)millis());
+  return mancano > 0 ? (unsigned long)mancano : 0;
+}
+
+int Scheduler::numeroTask() const {
+  return _n;
+}
+
+bool Scheduler::prima(int a, int b) const {
+  return (int32_t)(_task[_heap[a]].scadenza - _task[_heap[b]].scadenza) < 0;
+}
+
+void Scheduler::scambia(int i, int j) {
+  int t = _heap[i];
+  _heap[i] = _heap[j];
+  _heap[j] = t;
+  _posizione[_heap[i]] = i;
+  _posizione[_heap[j]] = j;
+}
+
+void Scheduler::sali(int i) {
+  while(i > 0 && prima(i, (i - 1) / 2)) {
+    scambia(i, (i - 1) / 2);
+    i = (i - 1) / 2;
+  }
+}
+
+void Scheduler::scendi(int i) {
+  for(;;) {
+    int minimo = i;
+    int s = 2 * i + 1, d = 2 * i + 2;
+    if(s < _n && prima(s, minimo)) minimo = s;
+    if(d < _n && prima(d, minimo)) minimo = d;
+    if(minimo == i) return;
+    scambia(i, minimo);
+    i = minimo;
+  }
+}
+
+void Scheduler::rimuovi(int i) {
+  int id = _heap[i];
+  _n--;
+  if(i != _n) {
+    scambia(i, _n);
+    sali(i);
+    scendi(i);
+  }
+  _posizione[id] = -1;
+}
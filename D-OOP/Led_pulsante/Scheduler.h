@@ -0,0 +1,111 @@
+/** ****************************************************************************************
+* @file Scheduler.h
+* @brief Scheduler cooperativo basato su millis(): esegue funzioni dopo un ritardo o periodicamente
+*
+* È la versione riutilizzabile della tecnica "if (millis() - previousMillis >= interval)"
+* vista in H-Misc/1.3: invece di controllare ogni task ad ogni giro di loop(),
+* le scadenze sono tenute in un min-heap (la prima scadenza è sempre in cima).
+* Se nessun task è scaduto esegui() fa un solo confronto, indipendentemente dal
+* numero di task registrati; aggiungere o annullare un task costa O(log n).
+*
+* Non usa memoria dinamica: al massimo SCHEDULER_MAX_TASK task (default 16).
+* Le funzioni dei task non devono bloccare (niente delay()).
+*
+* Esempio:
+*   void lampeggia(void *dato) { ((LED *)dato)->inverti(); }
+*   scheduler.ogni(500, lampeggia, &led1);   // in setup()
+*   scheduler.esegui();                      // in loop()
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#ifndef SCHEDULER_MAX_TASK
+#define SCHEDULER_MAX_TASK 16
+#endif
+
+/// Funzione eseguita da un task; dato è il puntatore passato alla registrazione
+typedef void (*FunzioneTask)(void *dato);
+
+/**
+ * @class Scheduler
+ * @brief Coda di task ordinata per scadenza (min-heap)
+ */
+class Scheduler {
+  public:
+    static const int NESSUN_TASK = -1;
+
+    Scheduler();
+
+    /**
+    * @brief Esegue f(dato) una volta, tra ritardo millisecondi
+    * @return identificativo del task, NESSUN_TASK se non c'è più posto
+    */
+    int dopo(unsigned long ritardo, FunzioneTask f, void *dato = 0);
+
+    /**
+    * @brief Esegue f(dato) ogni periodo millisecondi (la prima volta tra periodo ms)
+    * @return identificativo del task, NESSUN_TASK se non c'è più posto o se periodo è 0
+    *
+    * Le scadenze successive sono calcolate dalla scadenza precedente e non
+    * dall'istante di esecuzione: un ritardo occasionale non si accumula.
+    */
+    int ogni(unsigned long periodo, FunzioneTask f, void *dato = 0);
+
+    /**
+    * @brief Annulla un task (anche dall'interno della sua funzione)
+    * @return true se il task esisteva
+    */
+    bool annulla(int id);
+
+    /// true se il task id è ancora in attesa di essere eseguito
+    bool attivo(int id) const;
+
+    /**
+    * @brief Esegue i task scaduti; da chiamare ad ogni giro di loop()
+    * @return numero di task eseguiti
+    */
+    int esegui();
+
+    /**
+    * @brief Millisecondi che mancano alla prossima scadenza (0 se già scaduta)
+    *
+    * Il loop può usarlo per mettere in risparmio energetico il microcontrollore.
+    * Restituisce 0xFFFFFFFF se non ci sono task.
+    */
+    unsigned long attesa() const;
+
+    int numeroTask() const;
+
+  private:
+    struct Task {
+      // Sempre a 32 bit come millis() su AVR: su Linux unsigned long ne ha 64 e
+      // le differenze non riprenderebbero da 0 insieme a millis()
+      uint32_t scadenza;
+      uint32_t periodo;        // 0 = una sola volta
+      FunzioneTask funzione;
+      void *dato;
+    };
+
+    Task _task[SCHEDULER_MAX_TASK];
+    int _heap[SCHEDULER_MAX_TASK];        // indici di _task ordinati per scadenza
+    int _posizione[SCHEDULER_MAX_TASK];   // posizione di ogni task nell'heap, -1 = libero
+    int _n;
+
+    int registra(unsigned long ritardo, unsigned long periodo, FunzioneTask f, void *dato);
+    bool prima(int a, int b) const;
+    void scambia(int i, int j);
+    void sali(int i);
+    void scendi(int i);
+    void rimuovi(int i);
+};
+
+/// Scheduler condiviso, usato da LED e Pulsante (come Serial, è un oggetto globale)
+extern Scheduler scheduler;
+
+#endif
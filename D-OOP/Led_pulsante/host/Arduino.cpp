@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "Arduino.h"
+
+HardwareSerial Serial;
+
+static int modi[NUM_PIN];
+static int ingressi[NUM_PIN];
+static int uscite[NUM_PIN];
+static bool analogico[NUM_PIN];   // ultimo valore scritto con analogWrite()
+
+static bool virtuale = false;
+static unsigned long long adessoVirtuale = 0;   // microsecondi
+static unsigned int tempoLettura = 0;
+static bool silenziosa = false;
+static const std::chrono::steady_clock::time_point avvio = std::chrono::steady_clock::now();
+
+struct CambioIngresso {
+  unsigned long long us;
+  int pin;
+  int valore;
+};
+
+struct Campione {
+  unsigned long long us;
+  int pin;
+  bool analogico;
+  int valore;
+};
+
+// Dentro funzioni: i costruttori globali degli sketch (es. LED led1(27)) possono
+// chiamare pinMode() e digitalWrite() prima dell'inizializzazione di questo file
+static std::vector<CambioIngresso> &programma() {
+  static std::vector<CambioIngresso> v;
+  return v;
+}
+
+static std::vector<Campione> &traccia() {
+  static std::vector<Campione> v;
+  return v;
+}
+
+static size_t prossimoIngresso = 0;
+static bool registra = false;
+static int inizialeValore[NUM_PIN];       // uscite all'avvio della registrazione
+static bool inizialeAnalogico[NUM_PIN];
+
+static bool valido(int pin) {
+  return pin >= 0 && pin < NUM_PIN;
+}
+
+static unsigned long long microsecondi() {
+  if (virtuale) return adessoVirtuale;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - avvio).count();
+}
+
+static void applicaIngressi() {
+  std::vector<CambioIngresso> &p = programma();
+  if (prossimoIngresso == p.size()) return;
+  unsigned long long adesso = microsecondi();
+  while (prossimoIngresso < p.size() && p[prossimoIngresso].us <= adesso) {
+    ingressi[p[prossimoIngresso].pin] = p[prossimoIngresso].valore;
+    prossimoIngresso++;
+  }
+}
+
+static void scrivi(int pin, int valore, bool a) {
+  if (registra && (uscite[pin] != valore || analogico[pin] != a)) {
+    traccia().push_back({microsecondi(), pin, a, valore});
+  }
+  uscite[pin] = valore;
+  analogico[pin] = a;
+}
+
+void pinMode(int pin, int modo) {
+  if (!valido(pin)) return;
+  modi[pin] = modo;
+  if (modo == INPUT_PULLUP) ingressi[pin] = HIGH;   // pulsante non premuto
+}
+
+void digitalWrite(int pin, int valore) {
+  if (valido(pin)) scrivi(pin, valore ? HIGH : LOW, false);
+}
+
+int digitalRead(int pin) {
+  if (!valido(pin)) return LOW;
+  if (virtuale) adessoVirtuale += tempoLettura;
+  applicaIngressi();
+  return modi[pin] == OUTPUT ? uscite[pin] : ingressi[pin];
+}
+
+void analogWrite(int pin, int valore) {
+  if (valido(pin)) scrivi(pin, valore < 0 ? 0 : (valore > 255 ? 255 : valore), true);
+}
+
+// Come su Arduino i valori sono a 32 bit e ripartono da 0 quando traboccano
+unsigned long millis() {
+  return (uint32_t)(microsecondi() / 1000);
+}
+
+unsigned long micros() {
+  return (uint32_t)microsecondi();
+}
+
+void delay(unsigned long ms) {
+  if (virtuale) adessoVirtuale += 1000ULL * ms;
+  else std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (virtuale) adessoVirtuale += us;
+  else if (us > 0) std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+long map(long x, long daMin, long daMax, long aMin, long aMax) {
+  return (x - daMin) * (aMax - aMin) / (daMax - daMin) + aMin;
+}
+
+void HardwareSerial::begin(unsigned long) {}
+void HardwareSerial::print(const char *s) { if (!silenziosa) fputs(s, stdout); }
+void HardwareSerial::print(char c) { if (!silenziosa) putchar(c); }
+void HardwareSerial::print(int n) { if (!silenziosa) printf("%d", n); }
+void HardwareSerial::print(unsigned int n) { if (!silenziosa) printf("%u", n); }
+void HardwareSerial::print(long n) { if (!silenziosa) printf("%ld", n); }
+void HardwareSerial::print(unsigned long n) { if (!silenziosa) printf("%lu", n); }
+void HardwareSerial::print(double x) { if (!silenziosa) printf("%.2f", x); }
+void HardwareSerial::println() { if (!silenziosa) putchar('\n'); }
+
+//------------------------------------------------------------------------------------------
+//=== FUNZIONI HOST ========================================================================
+//------------------------------------------------------------------------------------------
+void hostOrologioVirtuale(bool v) {
+  virtuale = v;
+  adessoVirtuale = 0;
+}
+
+void hostAvanza(unsigned long us) {
+  adessoVirtuale += us;
+}
+
+unsigned long long hostMicros64() {
+  return microsecondi();
+}
+
+void hostImpostaIngresso(int pin, int valore) {
+  if (valido(pin)) ingressi[pin] = valore ? HIGH : LOW;
+}
+
+void hostTempoLettura(unsigned int us) {
+  tempoLettura = us;
+}
+
+void hostProgrammaIngresso(unsigned long long us, int pin, int valore) {
+  if (!valido(pin)) return;
+  std::vector<CambioIngresso> &p = programma();
+  // A parità di istante vale l'ordine di inserimento
+  auto dopo = std::upper_bound(p.begin() + prossimoIngresso, p.end(), us,
+                               [](unsigned long long t, const CambioIngresso &c) { return t < c.us; });
+  p.insert(dopo, {us, pin, valore ? HIGH : LOW});
+}
+
+int hostCaricaIngressi(const char *file) {
+  FILE *f = fopen(file, "r");
+  if (!f) return -1;
+  char riga[256];
+  int n = 0;
+  while (fgets(riga, sizeof(riga), f)) {
+    double ms;
+    int pin, valore;
+    if (riga[0] == '#') continue;
+    if (sscanf(riga, "%lf %d %d", &ms, &pin, &valore) == 3) {
+      hostProgrammaIngresso((unsigned long long)(ms * 1000 + 0.5), pin, valore);
+      n++;
+    }
+  }
+  fclose(f);
+  return n;
+}
+
+int hostUscita(int pin) {
+  return valido(pin) ? uscite[pin] : 0;
+}
+
+void hostRegistraTraccia(bool attiva) {
+  registra = attiva;
+  if (!attiva) return;
+  traccia().clear();
+  for (int i = 0; i < NUM_PIN; i++) {
+    inizialeValore[i] = uscite[i];
+    inizialeAnalogico[i] = analogico[i];
+  }
+}
+
+int hostLunghezzaTraccia() {
+  return (int)traccia().size();
+}
+
+static const char INTESTAZIONE[] = "tempo_us,pin,tipo,valore\n";
+
+static void formatta(const Campione &c, char *riga, size_t dim) {
+  snprintf(riga, dim, "%llu,%d,%c,%d\n", c.us, c.pin, c.analogico ? 'A' : 'D', c.valore);
+}
+
+bool hostSalvaTraccia(const char *file) {
+  FILE *f = fopen(file, "w");
+  if (!f) return false;
+  fputs(INTESTAZIONE, f);
+  char riga[64];
+  for (const Campione &c : traccia()) {
+    formatta(c, riga, sizeof(riga));
+    fputs(riga, f);
+  }
+  return fclose(f) == 0;
+}
+
+int hostConfrontaTraccia(const char *file) {
+  FILE *f = fopen(file, "r");
+  if (!f) return -1;
+  char letta[256], attesa[64];
+  int numero = 1;
+  int diversa = !fgets(letta, sizeof(letta), f) || strcmp(letta, INTESTAZIONE) != 0 ? 1 : 0;
+  for (size_t i = 0; !diversa && i < traccia().size(); i++) {
+    numero++;
+    formatta(traccia()[i], attesa, sizeof(attesa));
+    if (!fgets(letta, sizeof(letta), f) || strcmp(letta, attesa) != 0) diversa = numero;
+  }
+  if (!diversa && fgets(letta, sizeof(letta), f)) diversa = numero + 1;   // righe in più nel file
+  fclose(f);
+  return diversa;
+}
+
+double hostValoreMedio(int pin, unsigned long long da, unsigned long long a) {
+  if (!valido(pin) || a <= da) return 0;
+  double valore = inizialeAnalogico[pin] ? inizialeValore[pin] / 255.0 : inizialeValore[pin];
+  unsigned long long precedente = da;
+  double somma = 0;
+  for (const Campione &c : traccia()) {
+    if (c.pin != pin) continue;
+    if (c.us >= a) break;
+    if (c.us > precedente) {
+      somma += valore * (c.us - precedente);
+      precedente = c.us;
+    }
+    valore = c.analogico ? c.valore / 255.0 : c.valore;
+  }
+  somma += valore * (a - precedente);
+  return somma / (a - da);
+}
+
+void hostSerialeSilenziosa(bool s) {
+  silenziosa = s;
+}
@@ -0,0 +1,128 @@
+/** ****************************************************************************************
+* @file Arduino.h
+* @brief Simulatore di Arduino.h per compilare, provare e misurare gli sketch su Linux
+*
+* Fornisce le funzioni usate dagli esempi (pinMode, digitalWrite, digitalRead,
+* analogWrite, millis, micros, delay, map, Serial) e alcune funzioni "host..."
+* per i programmi di prova:
+*  - orologio reale (default): millis() e micros() misurano il tempo trascorso
+*    dall'avvio, delay() sospende davvero il programma;
+*  - orologio virtuale: il tempo avanza solo con delay() o hostAvanza(), quindi
+*    si possono simulare ore di funzionamento in pochi istanti;
+*  - ingressi programmati: livelli da applicare ad un pin ad un certo istante
+*    (es. un pulsante premuto a 1.5 s), anche letti da un file di testo;
+*  - registrazione della traccia: ogni cambio di un'uscita (digitalWrite o
+*    analogWrite/PWM) viene memorizzato con il suo istante e può essere salvato
+*    in CSV, confrontato con una traccia attesa o usato per calcolare il duty
+*    cycle medio di un pin.
+* esegui_sketch.cpp contiene un main() che esegue setup() e loop() di uno
+* sketch in tempo virtuale accelerato.
+*
+* Compilazione: g++ -I host -I . host/Arduino.cpp <file .cpp> ...
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+* @version 2.0 18/10/2026 Ingressi programmati, traccia delle uscite e PWM
+*/
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define NUM_PIN 64
+
+#define constrain(x, minimo, massimo) ((x) < (minimo) ? (minimo) : ((x) > (massimo) ? (massimo) : (x)))
+
+void pinMode(int pin, int modo);
+void digitalWrite(int pin, int valore);
+int digitalRead(int pin);
+void analogWrite(int pin, int valore);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+long map(long x, long daMin, long daMax, long aMin, long aMax);
+
+class HardwareSerial {
+  public:
+    void begin(unsigned long baud);
+    void print(const char *s);
+    void print(char c);
+    void print(int n);
+    void print(unsigned int n);
+    void print(long n);
+    void print(unsigned long n);
+    void print(double x);
+    void println();
+    template <typename T>
+    void println(T x) {
+      print(x);
+      println();
+    }
+};
+
+extern HardwareSerial Serial;
+
+//=== Funzioni disponibili solo su Linux =======================================
+/// true: orologio virtuale che parte da 0; false: orologio reale
+void hostOrologioVirtuale(bool virtuale);
+/// Fa avanzare l'orologio virtuale di us microsecondi
+void hostAvanza(unsigned long us);
+/// Tempo in microsecondi a 64 bit (non riparte da 0 dopo 71 minuti come micros())
+unsigned long long hostMicros64();
+
+/// Imposta subito il livello letto da digitalRead() su un pin di ingresso
+void hostImpostaIngresso(int pin, int valore);
+/**
+ * @brief Microsecondi virtuali consumati da ogni digitalRead() (default 0)
+ *
+ * Con l'orologio virtuale un ciclo che aspetta un pin, come while(press()),
+ * non terminerebbe mai: con un tempo di lettura > 0 il tempo avanza e gli
+ * ingressi programmati vengono applicati.
+ */
+void hostTempoLettura(unsigned int us);
+/// Programma il livello valore sul pin a partire dall'istante us
+void hostProgrammaIngresso(unsigned long long us, int pin, int valore);
+/**
+ * @brief Legge gli ingressi programmati da un file di testo
+ *
+ * Una riga per cambio di livello: "tempo_ms pin livello"; le righe che
+ * iniziano con # sono commenti. Restituisce il numero di righe lette, -1 se il
+ * file non esiste.
+ */
+int hostCaricaIngressi(const char *file);
+
+/// Ultimo valore scritto con digitalWrite() (0/1) o analogWrite() (0-255)
+int hostUscita(int pin);
+
+/// Attiva (e azzera) o disattiva la registrazione dei cambi delle uscite
+void hostRegistraTraccia(bool attiva);
+/// Numero di cambi registrati
+int hostLunghezzaTraccia();
+/// Salva la traccia in CSV: tempo_us,pin,tipo,valore (tipo D: digitalWrite 0/1, tipo A: analogWrite 0-255)
+bool hostSalvaTraccia(const char *file);
+/**
+ * @brief Confronta la traccia con un file salvato da hostSalvaTraccia()
+ * @return numero della prima riga diversa (1 = intestazione), 0 se uguali, -1 se il file non esiste
+ */
+int hostConfrontaTraccia(const char *file);
+/**
+ * @brief Valore medio di un'uscita nell'intervallo [da, a) in microsecondi, tra 0 e 1
+ *
+ * Per un pin PWM è il duty cycle medio (255 = 1), per un pin digitale la
+ * frazione di tempo a HIGH. Usa la traccia registrata.
+ */
+double hostValoreMedio(int pin, unsigned long long da, unsigned long long a);
+
+/// true: le stampe su Serial vengono scartate (utile nelle misure)
+void hostSerialeSilenziosa(bool silenziosa);
+
+#endif
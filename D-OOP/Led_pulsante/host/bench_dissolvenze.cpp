@@ -0,0 +1,125 @@
+/** ****************************************************************************************
+* @file bench_dissolvenze.cpp
+* @brief Prove di GruppoLED su Linux: correttezza delle dissolvenze e CPU per aggiornamento
+*
+* 1) Con l'orologio virtuale e la traccia delle uscite si verifica che:
+*    - una dissolvenza 0 -> 255 in 1 s sia a metà dopo 500 ms e finisca a 255;
+*    - il duty cycle medio di un LED che "respira" sia quello della curva gamma
+*      (media di x^2.2 su una rampa = 1 / 3.2);
+*    - la tabella gamma calcolata dal compilatore coincida con pow().
+* 2) CPU per aggiornamento con 32 LED che respirano con periodi diversi, 60 s
+*    di tempo virtuale: GruppoLED (virgola fissa, tabella, una passata, PWM
+*    scritto solo se cambia) contro un ciclo "ingenuo" che per ogni LED calcola
+*    la luminosità in float, applica pow() e chiama sempre setLuminosita().
+*
+* Compilazione (dalla cartella Led_pulsante):
+*   g++ -std=c++17 -O2 -I host -I . host/Arduino.cpp Scheduler.cpp LED.cpp GruppoLED.cpp
+*       host/bench_dissolvenze.cpp -o bench_dissolvenze
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+#include "Arduino.h"
+#include "GruppoLED.h"
+#include "LED.h"
+
+const int N = 32;
+const unsigned long DURATA_MS = 60000;
+
+//------------------------------------------------------------------------------------------
+//=== 1) CORRETTEZZA =======================================================================
+//------------------------------------------------------------------------------------------
+static bool provaCorrettezza() {
+  bool ok = true;
+  int massimoErrore = 0;
+  for (int l = 0; l < 256; l++) {
+    int atteso = (int)(255 * pow(l / 255.0, 2.2) + 0.5);
+    int errore = abs(GruppoLED::GAMMA.duty[l] - atteso);
+    if (errore > massimoErrore) massimoErrore = errore;
+  }
+  ok = massimoErrore == 0;
+  printf("Tabella gamma: errore massimo rispetto a pow() %d\n", massimoErrore);
+
+  hostOrologioVirtuale(true);
+  hostRegistraTraccia(true);
+  LED a(2), b(3);
+  GruppoLED gruppo;
+  gruppo.aggiungi(a);
+  gruppo.aggiungi(b);
+  gruppo.dissolvenza(a, 255, 1000);
+  gruppo.dissolvenza(b, 255, 500, true);
+  int meta = -1;
+  for (unsigned long ms = 0; ms <= 10000; ms++) {
+    if (ms == 500) meta = gruppo.luminosita(a);
+    gruppo.aggiorna();
+    delay(1);
+  }
+  bool fine = a.getLuminosita() == 255 && !gruppo.attiva(a) && gruppo.attiva(b);
+  double medio = hostValoreMedio(3, 0, 10000000);
+  printf("Dissolvenza 0->255 in 1 s: %d a 500 ms, %s\n", meta, fine ? "finita a 255" : "ERRORE alla fine");
+  printf("LED che respira: duty medio %.4f (atteso circa %.4f)\n", medio, 1 / 3.2);
+  ok = ok && meta >= 126 && meta <= 129 && fine && fabs(medio - 1 / 3.2) < 0.01;
+  hostRegistraTraccia(false);
+  return ok;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) CPU PER AGGIORNAMENTO =============================================================
+//------------------------------------------------------------------------------------------
+struct Ingenua {
+  unsigned long periodo;   // ms per mezza respirazione
+};
+
+/// ns per aggiornamento di 32 LED; modo 0 = solo il ciclo, 1 = GruppoLED, 2 = ingenuo
+static double simula(unsigned long tick, int modo) {
+  hostOrologioVirtuale(true);
+  std::vector<LED *> led;
+  std::vector<Ingenua> ingenua;
+  GruppoLED gruppo;
+  for (int i = 0; i < N; i++) {
+    led.push_back(new LED(i));
+    gruppo.aggiungi(*led[i]);
+    ingenua.push_back({700 + 37UL * i});
+    if (modo == 1) gruppo.dissolvenza(*led[i], 255, ingenua[i].periodo, true);
+  }
+  unsigned long giri = 0;
+  auto inizio = std::chrono::steady_clock::now();
+  for (unsigned long t = 0; t < DURATA_MS; t += tick) {
+    if (modo == 1) {
+      gruppo.aggiorna();
+    } else if (modo == 2) {
+      unsigned long adesso = millis();
+      for (int i = 0; i < N; i++) {
+        unsigned long p = ingenua[i].periodo;
+        float x = (float)(adesso % p) / p;
+        if ((adesso / p) & 1) x = 1 - x;
+        led[i]->setLuminosita((int)(255 * powf(x, 2.2f) + 0.5f));
+      }
+    }
+    giri++;
+    delay(tick);
+  }
+  std::chrono::duration<double> durata = std::chrono::steady_clock::now() - inizio;
+  for (int i = 0; i < N; i++) delete led[i];
+  return durata.count() / giri * 1e9;
+}
+
+int main() {
+  bool ok = provaCorrettezza();
+
+  printf("\n%d LED che respirano, %lu s di tempo virtuale\n", N, DURATA_MS / 1000);
+  printf("tick ms   GruppoLED ns   ingenuo ns\n");
+  const unsigned long tick[] = {1, PERIODO_DISSOLVENZE};
+  for (unsigned long t : tick) {
+    double base = simula(t, 0);
+    double gruppo = simula(t, 1) - base;
+    double ingenuo = simula(t, 2) - base;
+    printf("%7lu   %12.1f   %10.1f\n", t, gruppo, ingenuo);
+  }
+  return ok ? 0 : 1;
+}
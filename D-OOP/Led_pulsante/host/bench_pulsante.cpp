@@ -0,0 +1,172 @@
+/** ****************************************************************************************
+* @file bench_pulsante.cpp
+* @brief Eventi e tempo di loop consumato da 32 pulsanti con rimbalzi, simulati su Linux
+*
+* Ogni pulsante esegue per 60 s (tempo virtuale) una sequenza casuale di click,
+* doppi click e pressioni lunghe; ogni fronte è seguito da 0-4 rimbalzi di
+* 0.2-1 ms. loop() gira ogni 100 us. Si confrontano:
+*  - 32 chiamate a Pulsante::aggiorna() per giro di loop;
+*  - una chiamata a GruppoPulsanti::aggiorna() (antirimbalzo bit-parallelo).
+* Entrambe devono riconoscere esattamente i gesti generati; si stampa il tempo
+* reale consumato per giro di loop, al netto della simulazione dei pin.
+* (La versione 1.0 di click() bloccherebbe il loop per tutta la durata di ogni pressione.)
+*
+* Compilazione (dalla cartella Led_pulsante):
+*   g++ -std=c++17 -O2 -I host -I . host/Arduino.cpp Scheduler.cpp Pulsante.cpp
+*       GruppoPulsanti.cpp host/bench_pulsante.cpp -o bench_pulsante
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <vector>
+#include "Arduino.h"
+#include "GruppoPulsanti.h"
+#include "Pulsante.h"
+
+const int N = 32;
+const unsigned long DURATA_US = 60000000;   // 60 s
+const unsigned long GIRO_US = 100;          // un giro di loop ogni 100 us
+
+struct Fronte {
+  unsigned long us;
+  int livello;     // livello del pin: LOW = premuto (INPUT_PULLUP)
+};
+
+struct Copione {
+  std::vector<Fronte> fronti;
+  int click = 0, doppi = 0, lunghe = 0;   // gesti generati
+};
+
+static int contati[N][NUM_EVENTI_PULSANTE];
+
+/// Aggiunge un cambio di livello con i suoi rimbalzi
+static void cambia(Copione &c, unsigned long &t, int livello, std::mt19937 &gen) {
+  int rimbalzi = gen() % 5;
+  for (int i = 0; i < rimbalzi; i++) {
+    c.fronti.push_back({t, livello});
+    t += 200 + gen() % 800;
+    c.fronti.push_back({t, !livello});
+    t += 200 + gen() % 800;
+  }
+  c.fronti.push_back({t, livello});
+}
+
+static Copione creaCopione(std::mt19937 &gen) {
+  Copione c;
+  unsigned long t = 0;
+  for (;;) {
+    t += 400000 + gen() % 1600000;   // riposo 0.4-2 s
+    if (t + 3000000 > DURATA_US) break;
+    int gesto = gen() % 3;
+    if (gesto == 0) {                 // click
+      cambia(c, t, LOW, gen);
+      t += 80000 + gen() % 70000;
+      cambia(c, t, HIGH, gen);
+      c.click++;
+    } else if (gesto == 1) {          // doppio click
+      cambia(c, t, LOW, gen);
+      t += 80000;
+      cambia(c, t, HIGH, gen);
+      t += 120000;
+      cambia(c, t, LOW, gen);
+      t += 80000;
+      cambia(c, t, HIGH, gen);
+      c.doppi++;
+    } else {                          // pressione lunga
+      cambia(c, t, LOW, gen);
+      t += 1000000 + gen() % 500000;
+      cambia(c, t, HIGH, gen);
+      c.lunghe++;
+    }
+  }
+  return c;
+}
+
+template <int E>
+static void conta(Pulsante &p) {
+  contati[p.getPin()][E]++;
+}
+
+static void registra(Pulsante &p) {
+  p.suEvento(PRESSIONE, conta<PRESSIONE>);
+  p.suEvento(RILASCIO, conta<RILASCIO>);
+  p.suEvento(CLICK, conta<CLICK>);
+  p.suEvento(DOPPIO_CLICK, conta<DOPPIO_CLICK>);
+  p.suEvento(PRESSIONE_LUNGA, conta<PRESSIONE_LUNGA>);
+}
+
+/// Simula DURATA_US di funzionamento; modo 0 = solo pin, 1 = Pulsante, 2 = GruppoPulsanti
+static double simula(const std::vector<Copione> &copioni, int modo) {
+  hostOrologioVirtuale(true);
+  for (int i = 0; i < N; i++) hostImpostaIngresso(i, HIGH);
+  std::vector<Pulsante *> p;
+  GruppoPulsanti gruppo;
+  for (int i = 0; i < N; i++) {
+    p.push_back(new Pulsante(i));
+    registra(*p[i]);
+    gruppo.aggiungi(*p[i]);
+    for (int e = 0; e < NUM_EVENTI_PULSANTE; e++) contati[i][e] = 0;
+  }
+  std::vector<size_t> prossimo(N, 0);
+
+  auto inizio = std::chrono::steady_clock::now();
+  for (unsigned long t = 0; t < DURATA_US; t += GIRO_US) {
+    for (int i = 0; i < N; i++) {
+      const std::vector<Fronte> &f = copioni[i].fronti;
+      while (prossimo[i] < f.size() && f[prossimo[i]].us <= t) {
+        hostImpostaIngresso(i, f[prossimo[i]].livello);
+        prossimo[i]++;
+      }
+    }
+    if (modo == 1) {
+      for (int i = 0; i < N; i++) p[i]->aggiorna();
+    } else if (modo == 2) {
+      gruppo.aggiorna();
+    }
+    hostAvanza(GIRO_US);
+  }
+  std::chrono::duration<double> durata = std::chrono::steady_clock::now() - inizio;
+  for (int i = 0; i < N; i++) delete p[i];
+  return durata.count();
+}
+
+static bool verifica(const std::vector<Copione> &copioni, const char *nome) {
+  bool ok = true;
+  for (int i = 0; i < N; i++) {
+    const Copione &c = copioni[i];
+    int pressioni = c.click + 2 * c.doppi + c.lunghe;
+    ok = ok && contati[i][CLICK] == c.click && contati[i][DOPPIO_CLICK] == c.doppi &&
+         contati[i][PRESSIONE_LUNGA] == c.lunghe && contati[i][PRESSIONE] == pressioni &&
+         contati[i][RILASCIO] == pressioni;
+  }
+  printf("%-16s eventi %s\n", nome, ok ? "corretti" : "ERRATI");
+  return ok;
+}
+
+int main() {
+  std::mt19937 gen(42);
+  std::vector<Copione> copioni;
+  int gesti = 0;
+  for (int i = 0; i < N; i++) {
+    copioni.push_back(creaCopione(gen));
+    gesti += copioni[i].click + copioni[i].doppi + copioni[i].lunghe;
+  }
+  printf("%d pulsanti, %d gesti con rimbalzi in %lu s, un giro di loop ogni %lu us\n",
+         N, gesti, DURATA_US / 1000000, GIRO_US);
+
+  double base = simula(copioni, 0);
+  double singoli = simula(copioni, 1);
+  bool ok = verifica(copioni, "Pulsante x32");
+  double gruppo = simula(copioni, 2);
+  ok = verifica(copioni, "GruppoPulsanti") && ok;
+
+  const double giri = DURATA_US / GIRO_US;
+  printf("\nTempo per giro di loop (ns)  %% di un giro da %lu us\n", GIRO_US);
+  printf("Pulsante x32     %8.1f          %6.3f%%\n", (singoli - base) / giri * 1e9, (singoli - base) / giri / (GIRO_US * 1e-6) * 100);
+  printf("GruppoPulsanti   %8.1f          %6.3f%%\n", (gruppo - base) / giri * 1e9, (gruppo - base) / giri / (GIRO_US * 1e-6) * 100);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+/** ****************************************************************************************
+* @file bench_scheduler.cpp
+* @brief Prove dello Scheduler su Linux: funzionamento, costo di un giro di loop e jitter
+*
+* 1) Con l'orologio virtuale si verifica che LED::avviaLampeggio() e
+*    Pulsante::clickAvvenuto() funzionino senza bloccare, anche a cavallo
+*    del momento in cui millis() riparte da 0 (dopo 2^32 ms, circa 49 giorni).
+* 2) Costo di un giro di loop() con N task periodici (orologio virtuale, che
+*    avanza di 1 us per giro): Scheduler contro il controllo "a mano" di H-Misc/1.3,
+*    cioè un if (millis() - precedente >= intervallo) per ogni task.
+* 3) Jitter con l'orologio reale: ritardo tra la scadenza prevista e
+*    l'esecuzione effettiva di 8 task periodici per 2 secondi.
+*
+* Compilazione (dalla cartella Led_pulsante):
+*   g++ -std=c++17 -O2 -DSCHEDULER_MAX_TASK=256 -I host -I . host/Arduino.cpp Scheduler.cpp
+*       LED.cpp Pulsante.cpp host/bench_scheduler.cpp -o bench_scheduler
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>
+#include <stdio.h>
+#include "Arduino.h"
+#include "LED.h"
+#include "Pulsante.h"
+#include "Scheduler.h"
+
+//------------------------------------------------------------------------------------------
+//=== 1) FUNZIONAMENTO =====================================================================
+//------------------------------------------------------------------------------------------
+static bool provaFunzionamento() {
+  hostOrologioVirtuale(true);
+  LED led(27);
+  Pulsante p(25);
+  p.avvia();
+  p.avvia();   // non deve registrare un secondo task
+
+  // 3 lampeggi da 100 ms: 6 fasi, il LED deve cambiare 5 volte e finire spento
+  led.avviaLampeggio(3, 100);
+  int cambi = 0, precedente = hostUscita(27), click = 0;
+  for (int ms = 0; ms < 1000; ms++) {
+    if (ms == 200) hostImpostaIngresso(25, LOW);    // pulsante premuto...
+    if (ms == 350) hostImpostaIngresso(25, HIGH);   // ...e rilasciato
+    scheduler.esegui();
+    if (p.clickAvvenuto()) click++;
+    if (hostUscita(27) != precedente) cambi++;
+    precedente = hostUscita(27);
+    delay(1);
+  }
+  scheduler.annulla(0);   // task di lettura del pulsante
+  bool ok = cambi == 5 && hostUscita(27) == LOW && !led.staLampeggiando() && click == 1 &&
+            scheduler.numeroTask() == 0;
+  printf("Lampeggio non bloccante: %d cambi, click rilevati: %d -> %s\n", cambi, click, ok ? "OK" : "ERRORE");
+  return ok;
+}
+
+// Orologio virtuale 5 s prima che millis() riparta da 0: un task ogni 250 ms per 10 s
+// deve essere eseguito 40 volte e un click premuto 100 ms prima e rilasciato 100 ms
+// dopo deve essere rilevato una volta; ogni(0) viene rifiutato
+static bool provaRiavvioMillis() {
+  hostOrologioVirtuale(true);
+  hostAvanza((0x100000000ULL - 5000) * 1000);
+  Pulsante p(25);
+  p.avvia();
+  int volte = 0, click = 0;
+  int id = scheduler.ogni(250, [](void *dato) { (*(int *)dato)++; }, &volte);
+  int zero = scheduler.ogni(0, [](void *dato) { (*(int *)dato)++; }, &volte);
+  for (int ms = 0; ms <= 10000; ms++) {
+    if (ms == 4900) hostImpostaIngresso(25, LOW);
+    if (ms == 5100) hostImpostaIngresso(25, HIGH);
+    scheduler.esegui();
+    if (p.clickAvvenuto()) click++;
+    delay(1);
+  }
+  unsigned long attesa = scheduler.attesa();
+  for (int i = 0; i < SCHEDULER_MAX_TASK; i++) scheduler.annulla(i);
+  bool ok = id != Scheduler::NESSUN_TASK && zero == Scheduler::NESSUN_TASK && volte == 40 && click == 1 && attesa <= 250 &&
+            scheduler.numeroTask() == 0;
+  printf("Riavvio di millis(): task da 250 ms eseguito %d volte in 10 s, click rilevati: %d -> %s\n",
+         volte, click, ok ? "OK" : "ERRORE");
+  return ok;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) COSTO DI UN GIRO DI LOOP ==========================================================
+//------------------------------------------------------------------------------------------
+static unsigned long eseguiti = 0;
+
+static void task(void *) {
+  eseguiti++;
+}
+
+/// ns reali per giro di loop() con n task (periodi da 10 a 10 + n - 1 ms)
+static double costoScheduler(int n, unsigned long giri) {
+  hostOrologioVirtuale(true);
+  for (int i = 0; i < n; i++) scheduler.ogni(10 + i, task, 0);
+  auto inizio = std::chrono::steady_clock::now();
+  for (unsigned long g = 0; g < giri; g++) {
+    scheduler.esegui();
+    hostAvanza(1);
+  }
+  std::chrono::duration<double> t = std::chrono::steady_clock::now() - inizio;
+  for (int i = 0; i < n; i++) scheduler.annulla(i);
+  return t.count() / giri * 1e9;
+}
+
+static double costoManuale(int n, unsigned long giri) {
+  hostOrologioVirtuale(true);
+  static unsigned long precedente[SCHEDULER_MAX_TASK], intervallo[SCHEDULER_MAX_TASK];
+  for (int i = 0; i < n; i++) {
+    precedente[i] = 0;
+    intervallo[i] = 10 + i;
+  }
+  auto inizio = std::chrono::steady_clock::now();
+  for (unsigned long g = 0; g < giri; g++) {
+    unsigned long adesso = millis();
+    for (int i = 0; i < n; i++) {
+      if (adesso - precedente[i] >= intervallo[i]) {
+        precedente[i] += intervallo[i];
+        task(0);
+      }
+    }
+    hostAvanza(1);
+  }
+  std::chrono::duration<double> t = std::chrono::steady_clock::now() - inizio;
+  return t.count() / giri * 1e9;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 3) JITTER ============================================================================
+//------------------------------------------------------------------------------------------
+struct Misura {
+  unsigned long prevista;   // prossima scadenza in ms
+  unsigned long periodo;
+  unsigned long massimo;    // jitter massimo in us
+  double somma;
+  unsigned long volte;
+};
+
+static void taskJitter(void *dato) {
+  Misura *m = (Misura *)dato;
+  unsigned long ritardo = micros() - m->prevista * 1000;
+  if (ritardo > m->massimo) m->massimo = ritardo;
+  m->somma += ritardo;
+  m->volte++;
+  m->prevista += m->periodo;
+}
+
+static void provaJitter() {
+  hostOrologioVirtuale(false);
+  Misura m[8];
+  int id[8];
+  for (int i = 0; i < 8; i++) {
+    m[i] = {millis() + i + 1, (unsigned long)i + 1, 0, 0, 0};
+    id[i] = scheduler.ogni(i + 1, taskJitter, &m[i]);
+  }
+  unsigned long fine = millis() + 2000, giri = 0;
+  while ((long)(millis() - fine) < 0) {
+    scheduler.esegui();
+    giri++;
+  }
+  for (int i = 0; i < 8; i++) scheduler.annulla(id[i]);
+
+  printf("\nJitter con orologio reale (2 s, %lu giri di loop):\n", giri);
+  printf("periodo ms  esecuzioni  medio us  massimo us\n");
+  for (int i = 0; i < 8; i++) {
+    printf("%9lu  %10lu  %8.1f  %10lu\n", m[i].periodo, m[i].volte, m[i].somma / m[i].volte, m[i].massimo);
+  }
+}
+
+int main() {
+  bool ok = provaFunzionamento();
+  ok = provaRiavvioMillis() && ok;
+
+  const unsigned long GIRI = 10000000;   // 10 s di tempo virtuale
+  printf("\nCosto di un giro di loop (ns), %lu giri:\n", GIRI);
+  printf("task   Scheduler   controllo a mano\n");
+  for (int n = 1; n <= SCHEDULER_MAX_TASK && n <= 256; n *= 4) {
+    eseguiti = 0;
+    double s = costoScheduler(n, GIRI);
+    unsigned long es = eseguiti;
+    eseguiti = 0;
+    double m = costoManuale(n, GIRI);
+    printf("%4d   %9.2f   %16.2f%s\n", n, s, m, es == eseguiti ? "" : "   (ERRORE: esecuzioni diverse)");
+    ok = ok && es == eseguiti;
+  }
+
+  provaJitter();
+  return ok ? 0 : 1;
+}
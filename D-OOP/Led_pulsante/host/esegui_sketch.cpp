@@ -0,0 +1,134 @@
+/** ****************************************************************************************
+* @file esegui_sketch.cpp
+* @brief Esegue uno sketch Arduino su Linux in tempo virtuale accelerato
+*
+* Chiama setup() e poi loop() finché il tempo virtuale non raggiunge la durata
+* richiesta; dopo ogni giro l'orologio avanza del passo indicato (oltre al
+* tempo consumato da delay() dentro lo sketch). Alla fine stampa su stderr:
+*  - il numero di giri e la velocità rispetto al tempo reale;
+*  - la latenza di loop() in tempo virtuale, cioè quanto lo sketch tiene
+*    fermo il loop con delay() o cicli di attesa (è il ritardo con cui
+*    reagirebbe ad un ingresso sulla scheda);
+*  - il tempo di CPU di loop() sul PC (medio, mediana, 99° percentile, massimo).
+* Le stampe su Serial vanno su stdout.
+*
+* Opzioni:
+*   -t ms     durata simulata (default 10000)
+*   -p us     avanzamento dell'orologio dopo ogni giro di loop (default 10)
+*   -l us     tempo virtuale di una digitalRead() (default 1, vedi hostTempoLettura)
+*   -i file   ingressi programmati, righe "tempo_ms pin livello"
+*   -o file   salva la traccia delle uscite in CSV
+*   -c file   confronta la traccia con una salvata prima: esce con 1 se è diversa
+*   -q        nessuna stampa su Serial
+*
+* Compilazione di main.ino (dalla cartella Led_pulsante):
+*   g++ -std=c++17 -O2 -I host -I . -include Arduino.h -x c++ main.ino -x none
+*       host/Arduino.cpp host/esegui_sketch.cpp LED.cpp Pulsante.cpp Scheduler.cpp -o main_host
+*   ./main_host -t 5000 -i host/ingressi_main.txt -o traccia.csv
+*   ./main_host -t 5000 -i host/ingressi_main.txt -c traccia.csv -q   (prova di regressione)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "Arduino.h"
+
+void setup();
+void loop();
+
+static void uso(const char *programma) {
+  fprintf(stderr, "uso: %s [-t ms] [-p us] [-l us] [-i ingressi] [-o traccia.csv] [-c attesa.csv] [-q]\n", programma);
+  exit(2);
+}
+
+int main(int argc, char *argv[]) {
+  unsigned long long durata = 10000000, passo = 10;
+  unsigned int lettura = 1;
+  const char *ingressi = 0, *salva = 0, *confronta = 0;
+  for (int i = 1; i < argc; i++) {
+    const char *o = argv[i];
+    if (strcmp(o, "-q") == 0) {
+      hostSerialeSilenziosa(true);
+      continue;
+    }
+    if (i + 1 >= argc) uso(argv[0]);
+    const char *v = argv[++i];
+    if (strcmp(o, "-t") == 0) durata = strtoull(v, 0, 10) * 1000;
+    else if (strcmp(o, "-p") == 0) passo = strtoull(v, 0, 10);
+    else if (strcmp(o, "-l") == 0) lettura = (unsigned int)strtoul(v, 0, 10);
+    else if (strcmp(o, "-i") == 0) ingressi = v;
+    else if (strcmp(o, "-o") == 0) salva = v;
+    else if (strcmp(o, "-c") == 0) confronta = v;
+    else uso(argv[0]);
+  }
+
+  hostOrologioVirtuale(true);
+  hostTempoLettura(lettura);
+  if (ingressi && hostCaricaIngressi(ingressi) < 0) {
+    fprintf(stderr, "impossibile leggere %s\n", ingressi);
+    return 2;
+  }
+  hostRegistraTraccia(true);
+
+  auto inizio = std::chrono::steady_clock::now();
+  setup();
+  unsigned long long fineSetup = hostMicros64();
+
+  std::vector<unsigned int> cpu;          // ns reali per giro
+  unsigned long long bloccoMassimo = 0, istanteMassimo = 0, bloccoTotale = 0;
+  while (hostMicros64() < durata) {
+    unsigned long long t0 = hostMicros64();
+    auto r0 = std::chrono::steady_clock::now();
+    loop();
+    auto r1 = std::chrono::steady_clock::now();
+    unsigned long long blocco = hostMicros64() - t0;
+    cpu.push_back((unsigned int)std::chrono::duration_cast<std::chrono::nanoseconds>(r1 - r0).count());
+    bloccoTotale += blocco;
+    if (blocco > bloccoMassimo) {
+      bloccoMassimo = blocco;
+      istanteMassimo = t0;
+    }
+    hostAvanza(passo);
+  }
+  std::chrono::duration<double> reale = std::chrono::steady_clock::now() - inizio;
+  fflush(stdout);
+
+  size_t giri = cpu.size();
+  fprintf(stderr, "\nsetup(): %.3f ms virtuali\n", fineSetup / 1000.0);
+  fprintf(stderr, "loop(): %zu giri in %.3f s virtuali, %.3f s reali (%.0fx)\n",
+          giri, hostMicros64() / 1e6, reale.count(), hostMicros64() / 1e6 / reale.count());
+  if (giri > 0) {
+    double somma = 0;
+    for (unsigned int ns : cpu) somma += ns;
+    std::sort(cpu.begin(), cpu.end());
+    fprintf(stderr, "latenza virtuale (delay e attese): media %.1f us, massima %llu us a %.3f s\n",
+            (double)bloccoTotale / giri, bloccoMassimo, istanteMassimo / 1e6);
+    fprintf(stderr, "CPU per giro (ns): media %.1f, mediana %u, 99%% %u, massimo %u\n",
+            somma / giri, cpu[giri / 2], cpu[giri * 99 / 100], cpu[giri - 1]);
+  }
+  fprintf(stderr, "traccia: %d cambi delle uscite\n", hostLunghezzaTraccia());
+
+  if (salva && !hostSalvaTraccia(salva)) {
+    fprintf(stderr, "impossibile scrivere %s\n", salva);
+    return 2;
+  }
+  if (confronta) {
+    int riga = hostConfrontaTraccia(confronta);
+    if (riga < 0) {
+      fprintf(stderr, "impossibile leggere %s\n", confronta);
+      return 2;
+    }
+    if (riga > 0) {
+      fprintf(stderr, "traccia DIVERSA da %s alla riga %d\n", confronta, riga);
+      return 1;
+    }
+    fprintf(stderr, "traccia uguale a %s\n", confronta);
+  }
+  return 0;
+}
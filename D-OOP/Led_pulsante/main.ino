@@ -8,6 +8,7 @@
 * @author Filippo Bilardo
 * @date 26/02/23
 * @version 1.0 26/02/23 Versione iniziale
+* @version 1.1 18/10/2026 Click di P2 non bloccante (aggiorna + clickAvvenuto)
 */
 //------------------------------------------------------------------------------------------
 //=== INCLUDES =============================================================================
@@ -46,8 +47,8 @@ void setup(void) {
 //=== MAIN LOOP ============================================================================
 //------------------------------------------------------------------------------------------
 void loop(void) {
+  P2->aggiorna(); // Antirimbalzo ed eventi di P2, senza bloccare il loop
   P1->test(1); // Esegue il test per verificare se è stato effettuata una pressiones
-  P2->test(2); // Esegue il test per verificare se è stato effettuato un click
    
   if(P1->press()) {
     led1.accendi();
@@ -55,7 +56,8 @@ void loop(void) {
     led1.spegni();
   }
   
-  if(P2->click()) {
+  if(P2->clickAvvenuto()) {
+    Serial.println("Click");
     led2.inverti();
   }
 }
@@ -0,0 +1,243 @@
+/** ****************************************************************************************
+* @file FSM.h
+* @brief Libreria (solo header) per macchine a stati guidate da tabella costruita a compile time
+*
+* Come nell'approccio a "tabelle di transizione" del capitolo 3.2, il
+* comportamento dell'automa è descritto da una tabella stato x evento -> nuovo stato.
+* Qui però:
+*  - la tabella è un array constexpr costruito dal compilatore a partire
+*    dall'elenco delle transizioni (quelle non elencate lasciano lo stato invariato);
+*  - un elenco con due transizioni diverse per la stessa coppia (stato, evento)
+*    (automa non deterministico) è un errore di compilazione;
+*  - gestire un evento è un solo accesso all'array: O(1), senza switch né
+*    chiamate virtuali. Le azioni sono metodi statici di una classe passata come
+*    parametro template, quindi il compilatore le può espandere inline.
+*
+* Stati ed eventi sono enum (meglio enum class) con valori consecutivi da 0.
+*
+* Esempio:
+*   enum class Stato  { SPENTO, ACCESO };
+*   enum class Evento { PREMI };
+*   constexpr fsm::Transizione<Stato, Evento> t[] = {
+*       {Stato::SPENTO, Evento::PREMI, Stato::ACCESO},
+*       {Stato::ACCESO, Evento::PREMI, Stato::SPENTO},
+*   };
+*   constexpr auto tabella = fsm::creaTabella<2, 1>(t);
+*   fsm::Macchina<tabella> m(Stato::SPENTO);
+*   m.gestisci(Evento::PREMI);   // m.stato() == Stato::ACCESO
+*
+* La tabella si può generare da un diagramma PlantUML con puml2fsm.py.
+* Per le macchine gerarchiche (stati composti) si usa creaTabellaGerarchica.
+*
+* Compilazione: richiede C++20 (oggetti constexpr come parametri template)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef FSM_H
+#define FSM_H
+
+#include <array>      // array
+#include <cstddef>    // size_t
+#include <stdexcept>  // logic_error
+#include <type_traits> // remove_cvref_t, is_same_v
+
+namespace fsm {
+
+/// Una riga del diagramma di stato: da --evento--> a
+template <typename S, typename E>
+struct Transizione {
+	S da;
+	E evento;
+	S a;
+};
+
+/// Tabella densa NS x NE: prossimo[stato][evento] = nuovo stato
+template <typename S, typename E, size_t NS, size_t NE>
+struct Tabella {
+	using Stato = S;
+	using Evento = E;
+	static constexpr size_t NUM_STATI = NS;
+	static constexpr size_t NUM_EVENTI = NE;
+
+	std::array<std::array<S, NE>, NS> prossimo;
+
+	constexpr S operator()(S s, E e) const {
+		return prossimo[static_cast<size_t>(s)][static_cast<size_t>(e)];
+	}
+};
+
+/**
+ * @brief Costruisce a compile time la tabella a partire dall'elenco delle transizioni
+ *
+ * Usata in un contesto constexpr, una transizione non valida (stato o evento
+ * fuori intervallo, coppia stato/evento duplicata) blocca la compilazione.
+ */
+template <size_t NS, size_t NE, typename S, typename E, size_t N>
+constexpr Tabella<S, E, NS, NE> creaTabella(const Transizione<S, E> (&elenco)[N]) {
+	Tabella<S, E, NS, NE> t{};
+	std::array<std::array<bool, NE>, NS> definita{};
+	for (size_t s = 0; s < NS; s++) {
+		for (size_t e = 0; e < NE; e++) {
+			t.prossimo[s][e] = static_cast<S>(s);   // evento ignorato: stato invariato
+		}
+	}
+	for (size_t i = 0; i < N; i++) {
+		size_t s = static_cast<size_t>(elenco[i].da);
+		size_t e = static_cast<size_t>(elenco[i].evento);
+		if (s >= NS || e >= NE || static_cast<size_t>(elenco[i].a) >= NS) {
+			throw std::logic_error("fsm: stato o evento fuori intervallo");
+		}
+		if (definita[s][e] && t.prossimo[s][e] != elenco[i].a) {
+			throw std::logic_error("fsm: due transizioni per la stessa coppia stato/evento");
+		}
+		t.prossimo[s][e] = elenco[i].a;
+		definita[s][e] = true;
+	}
+	return t;
+}
+
+/// Relazione di una macchina gerarchica: figlio è un sottostato di padre
+template <typename S>
+struct Sottostato {
+	S figlio;
+	S padre;
+	bool iniziale;   // true: si entra in figlio quando si entra in padre
+};
+
+/**
+ * @brief Costruisce a compile time la tabella di una macchina a stati gerarchica
+ *
+ * La gerarchia viene "appiattita" nella stessa tabella densa di creaTabella,
+ * quindi la macchina si usa con Macchina e gestisce un evento in O(1):
+ *  - se uno stato non ha una transizione per un evento la eredita dal padre
+ *    (poi dal nonno, ...), come nel capitolo 8.1;
+ *  - una transizione verso uno stato composto entra nel suo sottostato iniziale
+ *    (ripetendo finché si arriva ad uno stato semplice, detto foglia).
+ * Lo stato corrente è quindi sempre una foglia: anche lo stato iniziale
+ * passato a Macchina deve esserlo.
+ */
+template <size_t NS, size_t NE, typename S, typename E, size_t N, size_t M>
+constexpr Tabella<S, E, NS, NE> creaTabellaGerarchica(const Transizione<S, E> (&elenco)[N],
+                                                      const Sottostato<S> (&gerarchia)[M]) {
+	std::array<size_t, NS> padre{}, iniziale{};
+	for (size_t s = 0; s < NS; s++) {
+		padre[s] = NS;      // NS = nessuno
+		iniziale[s] = NS;
+	}
+	for (size_t i = 0; i < M; i++) {
+		size_t f = static_cast<size_t>(gerarchia[i].figlio);
+		size_t p = static_cast<size_t>(gerarchia[i].padre);
+		if (f >= NS || p >= NS || f == p) {
+			throw std::logic_error("fsm: sottostato non valido");
+		}
+		if (padre[f] != NS && padre[f] != p) {
+			throw std::logic_error("fsm: uno stato ha due padri");
+		}
+		padre[f] = p;
+		if (gerarchia[i].iniziale) {
+			if (iniziale[p] != NS && iniziale[p] != f) {
+				throw std::logic_error("fsm: due sottostati iniziali per lo stesso stato");
+			}
+			iniziale[p] = f;
+		}
+	}
+	// Stati con figli ma senza sottostato iniziale
+	for (size_t s = 0; s < NS; s++) {
+		if (padre[s] != NS && iniziale[padre[s]] == NS) {
+			throw std::logic_error("fsm: stato composto senza sottostato iniziale");
+		}
+	}
+
+	// Transizioni definite esplicitamente (NS = non definita)
+	std::array<std::array<size_t, NE>, NS> diretta{};
+	for (auto &riga : diretta) {
+		for (auto &d : riga) d = NS;
+	}
+	for (size_t i = 0; i < N; i++) {
+		size_t s = static_cast<size_t>(elenco[i].da);
+		size_t e = static_cast<size_t>(elenco[i].evento);
+		size_t a = static_cast<size_t>(elenco[i].a);
+		if (s >= NS || e >= NE || a >= NS) {
+			throw std::logic_error("fsm: stato o evento fuori intervallo");
+		}
+		if (diretta[s][e] != NS && diretta[s][e] != a) {
+			throw std::logic_error("fsm: due transizioni per la stessa coppia stato/evento");
+		}
+		diretta[s][e] = a;
+	}
+
+	auto foglia = [&](size_t s) {
+		for (size_t passi = 0; iniziale[s] != NS; passi++) {
+			if (passi == NS) throw std::logic_error("fsm: ciclo nei sottostati iniziali");
+			s = iniziale[s];
+		}
+		return s;
+	};
+
+	Tabella<S, E, NS, NE> t{};
+	for (size_t s = 0; s < NS; s++) {
+		for (size_t e = 0; e < NE; e++) {
+			size_t a = s;                                  // nessuna transizione: stato invariato
+			size_t antenato = s;
+			for (size_t passi = 0; antenato != NS; passi++) {
+				if (passi == NS) throw std::logic_error("fsm: ciclo nella gerarchia degli stati");
+				if (diretta[antenato][e] != NS) {
+					a = foglia(diretta[antenato][e]);
+					break;
+				}
+				antenato = padre[antenato];
+			}
+			t.prossimo[s][e] = static_cast<S>(a);
+		}
+	}
+	return t;
+}
+
+/// Azioni di default: nessuna
+struct NessunaAzione {
+	template <typename S, typename E>
+	static void transizione(S, E, S) {}
+};
+
+/**
+ * @brief Istanza di una macchina a stati
+ * @tparam TABELLA tabella constexpr creata con creaTabella
+ * @tparam Azioni classe con un metodo statico transizione(da, evento, a),
+ *         chiamato solo quando lo stato cambia
+ */
+template <const auto &TABELLA, typename Azioni = NessunaAzione>
+class Macchina {
+public:
+	using Stato = typename std::remove_cvref_t<decltype(TABELLA)>::Stato;
+	using Evento = typename std::remove_cvref_t<decltype(TABELLA)>::Evento;
+
+	constexpr explicit Macchina(Stato iniziale) : corrente(iniziale) {}
+
+	constexpr Stato stato() const {
+		return corrente;
+	}
+
+	/// Gestisce un evento; restituisce true se lo stato è cambiato
+	constexpr bool gestisci(Evento e) {
+		Stato nuovo = TABELLA(corrente, e);
+		if constexpr (std::is_same_v<Azioni, NessunaAzione>) {
+			// Senza azioni non serve alcun salto condizionale
+			bool cambiato = nuovo != corrente;
+			corrente = nuovo;
+			return cambiato;
+		}
+		if (nuovo == corrente) return false;
+		Azioni::transizione(corrente, e, nuovo);
+		corrente = nuovo;
+		return true;
+	}
+
+private:
+	Stato corrente;
+};
+
+} // namespace fsm
+
+#endif
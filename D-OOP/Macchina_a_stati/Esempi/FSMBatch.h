@@ -0,0 +1,203 @@
+/** ****************************************************************************************
+* @file FSMBatch.h
+* @brief Esecuzione "in blocco" di milioni di istanze della stessa macchina a stati
+*
+* Quando ogni dispositivo (es. ogni semaforo di una città) ha la propria
+* istanza della stessa FSM, conviene non creare un oggetto Macchina per
+* dispositivo ma tenere tutti gli stati in un unico array di byte:
+*   stati:  s0 s1 s2 s3 ...      (un byte per istanza)
+*   eventi: e0 e1 e2 e3 ...      (un lotto: un evento per istanza)
+* Applicare un lotto significa calcolare per ogni i: stati[i] = tabella(stati[i], eventi[i]).
+*
+* Con le istruzioni SIMD il calcolo si fa su 32 (AVX2) o 16 (SSSE3) istanze
+* alla volta: l'indice stato * NE + evento diventa un byte e l'istruzione pshufb
+* (_mm256_shuffle_epi8) legge 32 byte da una tabella di 16 byte con una sola
+* operazione. Serve quindi che la tabella, con gli eventi arrotondati alla
+* potenza di 2, abbia al massimo 16 elementi (es. il semaforo: 3 stati x 4 eventi);
+* altrimenti, o senza AVX2/SSSE3, si usa il ciclo scalare.
+*
+* Con più thread le istanze vengono divise in fette contigue (sharding): ogni
+* thread applica tutti i lotti alla propria fetta, che resta nella sua cache.
+*
+* Compilazione: richiede C++20, es. g++ -std=c++20 -O2 -march=native -pthread
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef FSM_BATCH_H
+#define FSM_BATCH_H
+
+#include <algorithm>   // min
+#include <array>       // array
+#include <bit>         // popcount, bit_width
+#include <cstdint>     // uint8_t, uint32_t
+#include <thread>      // thread
+#include <vector>      // vector
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h> // _mm256_shuffle_epi8, _mm_shuffle_epi8
+#endif
+#include "FSM.h"
+
+namespace fsm {
+
+template <const auto &TABELLA>
+class EsecutoreBatch {
+public:
+	using T = std::remove_cvref_t<decltype(TABELLA)>;
+	using Stato = typename T::Stato;
+	using Evento = typename T::Evento;
+
+private:
+	static_assert(T::NUM_STATI <= 256, "EsecutoreBatch: uno stato deve stare in un byte");
+
+	// Indice piatto: (stato << BIT_EVENTI) | evento
+	static constexpr int BIT_EVENTI = std::bit_width(T::NUM_EVENTI - 1);
+	static constexpr size_t DIM = T::NUM_STATI << BIT_EVENTI;
+	static constexpr bool USA_PSHUFB = DIM <= 16;
+
+	static constexpr auto creaPiatta() {
+		std::array<uint8_t, (DIM < 16 ? 16 : DIM)> p{};
+		for (size_t s = 0; s < T::NUM_STATI; s++) {
+			for (size_t e = 0; e < T::NUM_EVENTI; e++) {
+				p[(s << BIT_EVENTI) | e] = static_cast<uint8_t>(TABELLA.prossimo[s][e]);
+			}
+		}
+		return p;
+	}
+	static constexpr auto PIATTA = creaPiatta();
+
+	std::vector<uint8_t> stati;
+
+	/// Applica un lotto alle istanze [inizio, fine); restituisce i cambi di stato
+	static size_t cicloScalare(uint8_t *s, const uint8_t *e, size_t inizio, size_t fine) {
+		size_t cambi = 0;
+		for (size_t i = inizio; i < fine; i++) {
+			uint8_t nuovo = PIATTA[(s[i] << BIT_EVENTI) | e[i]];
+			cambi += nuovo != s[i];
+			s[i] = nuovo;
+		}
+		return cambi;
+	}
+
+	static size_t cicloSIMD(uint8_t *s, const uint8_t *e, size_t inizio, size_t fine) {
+		size_t cambi = 0;
+		size_t i = inizio;
+		if constexpr (USA_PSHUFB) {
+#if defined(__AVX2__)
+			const __m256i tab = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)PIATTA.data()));
+			for (; i + 32 <= fine; i += 32) {
+				__m256i vs = _mm256_loadu_si256((const __m256i *)(s + i));
+				__m256i ve = _mm256_loadu_si256((const __m256i *)(e + i));
+				__m256i idx = vs;
+				for (int k = 0; k < BIT_EVENTI; k++) idx = _mm256_add_epi8(idx, idx); // stato << BIT_EVENTI
+				idx = _mm256_or_si256(idx, ve);
+				__m256i nuovo = _mm256_shuffle_epi8(tab, idx);
+				uint32_t uguali = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(nuovo, vs));
+				cambi += 32 - std::popcount(uguali);
+				_mm256_storeu_si256((__m256i *)(s + i), nuovo);
+			}
+#elif defined(__SSSE3__)
+			const __m128i tab = _mm_loadu_si128((const __m128i *)PIATTA.data());
+			for (; i + 16 <= fine; i += 16) {
+				__m128i vs = _mm_loadu_si128((const __m128i *)(s + i));
+				__m128i ve = _mm_loadu_si128((const __m128i *)(e + i));
+				__m128i idx = vs;
+				for (int k = 0; k < BIT_EVENTI; k++) idx = _mm_add_epi8(idx, idx);
+				idx = _mm_or_si128(idx, ve);
+				__m128i nuovo = _mm_shuffle_epi8(tab, idx);
+				uint32_t uguali = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(nuovo, vs));
+				cambi += 16 - std::popcount(uguali);
+				_mm_storeu_si128((__m128i *)(s + i), nuovo);
+			}
+#endif
+		}
+		return cambi + cicloScalare(s, e, i, fine);   // istanze rimaste (o tabella troppo grande)
+	}
+
+public:
+	EsecutoreBatch(size_t n, Stato iniziale) : stati(n, static_cast<uint8_t>(iniziale)) {}
+
+	size_t size() const {
+		return stati.size();
+	}
+
+	Stato stato(size_t i) const {
+		return static_cast<Stato>(stati[i]);
+	}
+
+	const std::vector<uint8_t> &getStati() const {
+		return stati;
+	}
+
+	/// true se il calcolo avviene 16 o 32 istanze alla volta
+	static constexpr bool vettoriale() {
+#if defined(__AVX2__) || defined(__SSSE3__)
+		return USA_PSHUFB;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Applica uno o più lotti di eventi
+	 * @param eventi lotti consecutivi di size() eventi ciascuno: l'evento del
+	 *        lotto k per l'istanza i è eventi[k * size() + i]; ogni valore deve
+	 *        essere minore di NUM_EVENTI
+	 * @param lotti numero di lotti
+	 * @param numThread thread tra cui dividere le istanze
+	 * @return numero totale di cambi di stato
+	 */
+	size_t applica(const Evento *eventi, size_t lotti = 1, unsigned numThread = 1) {
+		static_assert(sizeof(Evento) == 1, "EsecutoreBatch: Evento deve occupare un byte");
+		const size_t n = size();
+		const uint8_t *e = reinterpret_cast<const uint8_t *>(eventi);
+		uint8_t *s = stati.data();
+
+		auto fetta = [=](size_t inizio, size_t fine) {
+			size_t cambi = 0;
+			for (size_t k = 0; k < lotti; k++) {
+				cambi += cicloSIMD(s, e + k * n, inizio, fine);
+			}
+			return cambi;
+		};
+
+		if (numThread <= 1 || n < 4096) return fetta(0, n);
+
+		// Fette multiple di 64 byte: due thread non scrivono mai nella stessa linea di cache
+		size_t passo = ((n + numThread - 1) / numThread + 63) / 64 * 64;
+		std::vector<size_t> cambi(numThread, 0);
+		std::vector<std::thread> thread;
+		for (unsigned t = 0; t < numThread && t * passo < n; t++) {
+			size_t inizio = t * passo;
+			size_t fine = std::min(n, inizio + passo);
+			thread.emplace_back([&, t, inizio, fine] { cambi[t] = fetta(inizio, fine); });
+		}
+		size_t totale = 0;
+		for (unsigned t = 0; t < thread.size(); t++) {
+			thread[t].join();
+			totale += cambi[t];
+		}
+		return totale;
+	}
+
+	/// Applica lo stesso evento a tutte le istanze (es. lo scadere di un timer comune)
+	size_t applicaATutti(Evento ev, unsigned numThread = 1) {
+		std::vector<Evento> lotto(size(), ev);
+		return applica(lotto.data(), 1, numThread);
+	}
+
+	/// Versione di riferimento senza SIMD né thread (per i confronti)
+	size_t applicaScalare(const Evento *eventi, size_t lotti = 1) {
+		const uint8_t *e = reinterpret_cast<const uint8_t *>(eventi);
+		size_t cambi = 0;
+		for (size_t k = 0; k < lotti; k++) {
+			cambi += cicloScalare(stati.data(), e + k * size(), 0, size());
+		}
+		return cambi;
+	}
+};
+
+} // namespace fsm
+
+#endif
@@ -0,0 +1,321 @@
+/** ****************************************************************************************
+* @file FSMParallelo.h
+* @brief Macchine a stati parallele (regioni ortogonali) eseguite da un gruppo di thread
+*
+* Nel capitolo 8.3 ogni regione parallela ha il proprio thread e i dati
+* condivisi sono protetti da un std::mutex. Con molte regioni questo significa
+* molti thread (quasi sempre fermi) e attese sui mutex. Qui invece:
+*  - ogni Regione ha una "casella postale" (mailbox) per gli eventi: una coda
+*    circolare lock-free, in cui più thread possono inserire senza mutex;
+*  - un Esecutore con pochi thread (worker, tipicamente uno per core) esegue
+*    le regioni che hanno eventi in attesa;
+*  - semantica "run to completion": una regione gestisce un evento alla volta,
+*    mai da due worker contemporaneamente, e non viene interrotta a metà;
+*  - eventi prioritari (capitolo 8.2): ogni regione ha una seconda casella per
+*    gli eventi urgenti, che viene svuotata prima di quella normale dopo ogni
+*    evento gestito;
+*  - eccezioni: se la gestione di un evento lancia un'eccezione il worker la
+*    passa a Regione::errore() e continua con l'evento successivo.
+* Una regione che contiene una macchina gerarchica (vedi creaTabellaGerarchica
+* in FSM.h) si ottiene con RegioneFSM.
+*
+* Compilazione: richiede C++20, es. g++ -std=c++20 -O2 -pthread
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef FSM_PARALLELO_H
+#define FSM_PARALLELO_H
+
+#include <algorithm>   // max
+#include <atomic>      // atomic
+#include <bit>         // bit_ceil
+#include <cstdint>     // uint32_t, uint64_t, intptr_t
+#include <exception>   // exception_ptr, current_exception
+#include <memory>      // unique_ptr
+#include <stdexcept>   // invalid_argument
+#include <thread>      // thread, this_thread::yield
+#include <vector>      // vector
+#include "FSM.h"
+
+namespace fsm {
+
+/**
+ * @brief Coda circolare lock-free di capacità fissa (algoritmo di D. Vyukov)
+ *
+ * Ogni cella ha un numero di sequenza che dice se è libera per il prossimo
+ * inserimento o pronta per la prossima estrazione: produttori e consumatori
+ * si riservano una posizione con un compare_exchange sull'indice e poi
+ * lavorano sulla cella senza bloccare gli altri.
+ */
+template <typename T>
+class CodaLockFree {
+private:
+	struct Cella {
+		std::atomic<size_t> sequenza;
+		T dato;
+	};
+
+	std::unique_ptr<Cella[]> celle;
+	size_t maschera;
+	alignas(64) std::atomic<size_t> scrittura{0};   // indici su linee di cache diverse
+	alignas(64) std::atomic<size_t> lettura{0};
+
+public:
+	/// @throw std::invalid_argument se la capacità non è una potenza di 2
+	explicit CodaLockFree(size_t capacita) : celle(new Cella[capacita]), maschera(capacita - 1) {
+		if (capacita < 2 || (capacita & (capacita - 1)) != 0) {
+			throw std::invalid_argument("CodaLockFree: la capacita' deve essere una potenza di 2");
+		}
+		for (size_t i = 0; i < capacita; i++) celle[i].sequenza.store(i, std::memory_order_relaxed);
+	}
+
+	/// Inserisce v; restituisce false se la coda è piena
+	bool inserisci(const T &v) {
+		size_t pos = scrittura.load(std::memory_order_relaxed);
+		for (;;) {
+			Cella &c = celle[pos & maschera];
+			intptr_t diff = (intptr_t)c.sequenza.load(std::memory_order_acquire) - (intptr_t)pos;
+			if (diff == 0) {
+				if (scrittura.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					c.dato = v;
+					c.sequenza.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				return false;
+			} else {
+				pos = scrittura.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// Estrae in v il primo elemento; restituisce false se la coda è vuota
+	bool estrai(T &v) {
+		size_t pos = lettura.load(std::memory_order_relaxed);
+		for (;;) {
+			Cella &c = celle[pos & maschera];
+			intptr_t diff = (intptr_t)c.sequenza.load(std::memory_order_acquire) - (intptr_t)(pos + 1);
+			if (diff == 0) {
+				if (lettura.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					v = c.dato;
+					c.sequenza.store(pos + maschera + 1, std::memory_order_release);
+					return true;
+				}
+			} else if (diff < 0) {
+				return false;
+			} else {
+				pos = lettura.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// true se al momento della chiamata la coda non contiene elementi
+	bool vuota() const {
+		size_t pos = lettura.load(std::memory_order_acquire);
+		return (intptr_t)celle[pos & maschera].sequenza.load(std::memory_order_acquire) - (intptr_t)(pos + 1) < 0;
+	}
+};
+
+/// Evento inviato ad una regione
+struct Messaggio {
+	uint32_t evento;
+	uint32_t sorgente;   // libero per l'applicazione (es. chi ha inviato l'evento)
+	uint64_t dato;       // libero per l'applicazione (es. un istante di tempo)
+};
+
+enum class Priorita { NORMALE, URGENTE };
+
+class Esecutore;
+
+/**
+ * @brief Regione parallela: riceve eventi nella propria casella e li gestisce uno alla volta
+ *
+ * Le classi derivate implementano gestisci(); i dati della regione sono
+ * usati da un solo worker alla volta, quindi non servono mutex.
+ */
+class Regione {
+	friend class Esecutore;
+
+private:
+	CodaLockFree<Messaggio> urgenti;
+	CodaLockFree<Messaggio> normali;
+	std::atomic<bool> programmata{false};   // true: già nella coda delle regioni pronte
+	std::atomic<Esecutore *> esecutore{nullptr};   // assegnato al primo invia
+
+public:
+	/// @param capacita eventi che possono attendere in ciascuna casella (potenza di 2)
+	explicit Regione(size_t capacita = 1024) : urgenti(capacita), normali(capacita) {}
+	virtual ~Regione() = default;
+
+	Regione(const Regione &) = delete;
+	Regione &operator=(const Regione &) = delete;
+
+protected:
+	/// Gestisce un evento (run to completion)
+	virtual void gestisci(const Messaggio &m) = 0;
+
+	/// Chiamata se gestisci() lancia un'eccezione; di default l'evento viene scartato
+	virtual void errore(const Messaggio &, std::exception_ptr) {}
+};
+
+/**
+ * @brief Gruppo di worker che esegue le regioni con eventi in attesa
+ *
+ * Le regioni pronte stanno in una coda lock-free; il flag "programmata"
+ * garantisce che ogni regione compaia al massimo una volta. Al primo invia
+ * una regione viene assegnata all'Esecutore, che ne accetta al massimo
+ * quante sono le posizioni della coda: la coda non può quindi essere piena
+ * e nessuna regione programmata resta fuori. Una regione assegnata resta
+ * dell'Esecutore per tutta la sua vita (anche se viene distrutta). Un worker
+ * gestisce al massimo BUDGET eventi di una regione e poi la rimette in coda,
+ * così una regione molto trafficata non blocca le altre.
+ */
+class Esecutore {
+public:
+	static const int BUDGET = 64;
+
+private:
+	CodaLockFree<Regione *> pronte;
+	size_t capacita;                    // posizioni di pronte
+	std::atomic<size_t> regioni{0};     // regioni assegnate
+	std::vector<std::thread> worker;
+	std::atomic<bool> attivo{false};
+	std::atomic<uint32_t> segnale{0};   // incrementato ad ogni regione resa pronta
+
+	void sveglia() {
+		segnale.fetch_add(1, std::memory_order_release);
+		segnale.notify_one();
+	}
+
+	// Assegna r a questo Esecutore se non lo è già: false se appartiene ad un altro o non c'è posto
+	bool assegna(Regione &r) {
+		Esecutore *e = r.esecutore.load(std::memory_order_acquire);
+		if (e != nullptr) return e == this;
+		size_t n = regioni.load(std::memory_order_relaxed);
+		do {
+			if (n == capacita) return false;
+		} while (!regioni.compare_exchange_weak(n, n + 1, std::memory_order_relaxed));
+		if (r.esecutore.compare_exchange_strong(e, this, std::memory_order_acq_rel)) return true;
+		regioni.fetch_sub(1, std::memory_order_relaxed);   // assegnata nel frattempo da un altro thread
+		return e == this;
+	}
+
+	void programma(Regione &r) {
+		if (!r.programmata.exchange(true, std::memory_order_seq_cst)) {
+			// Non fallisce: al massimo capacita regioni assegnate, ognuna in coda una volta sola
+			pronte.inserisci(&r);
+			sveglia();
+		}
+	}
+
+	void esegui(Regione &r) {
+		Messaggio m;
+		for (int n = 0; n < BUDGET; n++) {
+			// Dopo ogni evento gestito gli urgenti passano davanti ai normali
+			if (!r.urgenti.estrai(m) && !r.normali.estrai(m)) break;
+			try {
+				r.gestisci(m);
+			} catch (...) {
+				r.errore(m, std::current_exception());
+			}
+		}
+		r.programmata.exchange(false, std::memory_order_seq_cst);   // barriera completa prima del controllo
+		// Eventi arrivati mentre la regione era in esecuzione (o budget esaurito)
+		if (!r.urgenti.vuota() || !r.normali.vuota()) programma(r);
+	}
+
+	void ciclo() {
+		Regione *r;
+		for (;;) {
+			uint32_t visto = segnale.load(std::memory_order_acquire);
+			bool trovata = false;
+			for (int tentativi = 0; tentativi < 64 && !trovata; tentativi++) {
+				trovata = pronte.estrai(r);
+				if (!trovata) std::this_thread::yield();
+			}
+			if (trovata) {
+				esegui(*r);
+			} else if (!attivo.load(std::memory_order_acquire)) {
+				return;                         // fermato e nessuna regione pronta
+			} else {
+				segnale.wait(visto);            // dorme finché qualcuno chiama sveglia()
+			}
+		}
+	}
+
+public:
+	/// @param maxRegioni numero massimo di regioni (arrotondato alla potenza di 2 successiva)
+	explicit Esecutore(size_t maxRegioni = 4096)
+		: pronte(std::bit_ceil(std::max<size_t>(maxRegioni, 2))), capacita(std::bit_ceil(std::max<size_t>(maxRegioni, 2))) {}
+
+	~Esecutore() {
+		ferma();
+	}
+
+	/// Avvia numWorker thread (0 = uno per core)
+	void avvia(unsigned numWorker = 0) {
+		if (attivo.exchange(true)) return;
+		if (numWorker == 0) numWorker = std::max(1u, std::thread::hardware_concurrency());
+		for (unsigned i = 0; i < numWorker; i++) worker.emplace_back([this] { ciclo(); });
+	}
+
+	/// Attende che gli eventi già inviati siano gestiti e termina i worker
+	void ferma() {
+		if (!attivo.exchange(false)) return;
+		segnale.fetch_add(1, std::memory_order_release);
+		segnale.notify_all();
+		for (auto &w : worker) w.join();
+		worker.clear();
+	}
+
+	/**
+	 * @brief Invia un evento ad una regione (da qualunque thread)
+	 * @return false se l'evento non è stato inviato: la casella della regione è
+	 *         piena, oppure la regione non è di questo Esecutore e non può
+	 *         diventarlo (appartiene ad un altro o ci sono già maxRegioni regioni)
+	 */
+	bool invia(Regione &r, const Messaggio &m, Priorita p = Priorita::NORMALE) {
+		CodaLockFree<Messaggio> &casella = p == Priorita::URGENTE ? r.urgenti : r.normali;
+		if (!assegna(r) || !casella.inserisci(m)) return false;
+		programma(r);
+		return true;
+	}
+};
+
+/**
+ * @brief Regione che contiene una macchina a stati di FSM.h (anche gerarchica)
+ *
+ * Il campo evento del messaggio è il valore dell'enum Evento della tabella.
+ */
+template <const auto &TABELLA, typename Azioni = NessunaAzione>
+class RegioneFSM : public Regione {
+public:
+	using Stato = typename Macchina<TABELLA, Azioni>::Stato;
+	using Evento = typename Macchina<TABELLA, Azioni>::Evento;
+
+private:
+	Macchina<TABELLA, Azioni> macchina;
+
+protected:
+	void gestisci(const Messaggio &m) override {
+		macchina.gestisci(static_cast<Evento>(m.evento));
+	}
+
+public:
+	explicit RegioneFSM(Stato iniziale, size_t capacita = 1024) : Regione(capacita), macchina(iniziale) {}
+
+	/// Stato corrente: da leggere solo quando la regione non riceve eventi (es. dopo ferma())
+	Stato stato() const {
+		return macchina.stato();
+	}
+
+	static Messaggio messaggio(Evento e, uint64_t dato = 0) {
+		return Messaggio{static_cast<uint32_t>(e), 0, dato};
+	}
+};
+
+} // namespace fsm
+
+#endif
@@ -0,0 +1,39 @@
+// File generato da puml2fsm.py a partire da Semaforo.puml: non modificare a mano
+#ifndef SEMAFORO_FSM_H
+#define SEMAFORO_FSM_H
+
+#include <cstdint>
+#include "FSM.h"
+
+namespace semaforo {
+
+enum class Stato : uint8_t { VERDE, GIALLO, ROSSO };
+enum class Evento : uint8_t { tempo_verde_scaduto, pulsante_prenotazione_premuto, tempo_giallo_scaduto, tempo_rosso_scaduto };
+
+inline constexpr size_t NUM_STATI = 3;
+inline constexpr size_t NUM_EVENTI = 4;
+inline constexpr Stato STATO_INIZIALE = Stato::VERDE;
+
+inline constexpr fsm::Transizione<Stato, Evento> transizioni[] = {
+	{Stato::VERDE, Evento::tempo_verde_scaduto, Stato::GIALLO},
+	{Stato::VERDE, Evento::pulsante_prenotazione_premuto, Stato::GIALLO},
+	{Stato::GIALLO, Evento::tempo_giallo_scaduto, Stato::ROSSO},
+	{Stato::ROSSO, Evento::tempo_rosso_scaduto, Stato::VERDE},
+	{Stato::ROSSO, Evento::pulsante_prenotazione_premuto, Stato::GIALLO},
+};
+
+inline constexpr auto tabella = fsm::creaTabella<NUM_STATI, NUM_EVENTI>(transizioni);
+
+inline const char *nome(Stato s) {
+	static const char *nomi[] = { "VERDE", "GIALLO", "ROSSO" };
+	return nomi[static_cast<size_t>(s)];
+}
+
+inline const char *nome(Evento e) {
+	static const char *nomi[] = { "tempo_verde_scaduto", "pulsante_prenotazione_premuto", "tempo_giallo_scaduto", "tempo_rosso_scaduto" };
+	return nomi[static_cast<size_t>(e)];
+}
+
+} // namespace semaforo
+
+#endif
@@ -0,0 +1,198 @@
+/** ****************************************************************************************
+* @file bench_fsm.cpp
+* @brief Confronto di velocità tra FSM.h (tabella constexpr), switch-case e Pattern Stato
+*
+* Tutte le versioni implementano il semaforo di Semaforo.puml e ricevono la
+* stessa sequenza di eventi casuali (generata prima della misura). Si contano
+* i cambi di stato e si verifica che tutte le versioni arrivino allo stesso
+* risultato; poi si stampa il numero di milioni di eventi al secondo.
+*
+* Il Pattern Stato è misurato in due varianti:
+*  - come nel capitolo 3.2: ad ogni transizione si crea il nuovo stato con new;
+*  - con un unico oggetto statico per stato (nessuna allocazione, resta la chiamata virtuale).
+*
+* Rigenerare la tabella: python3 puml2fsm.py Semaforo.puml
+* Compilazione: g++ -std=c++20 -O2 bench_fsm.cpp -o bench_fsm
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>     // steady_clock
+#include <cstdint>    // uint8_t, uint64_t
+#include <iostream>   // cout
+#include <random>     // mt19937
+#include <vector>     // vector
+#include "Semaforo_fsm.h"
+
+using namespace std;
+using semaforo::Evento;
+using semaforo::Stato;
+
+//------------------------------------------------------------------------------
+//=== SWITCH-CASE ==============================================================
+//------------------------------------------------------------------------------
+Stato prossimoSwitch(Stato s, Evento e) {
+	switch (s) {
+	case Stato::VERDE:
+		if (e == Evento::tempo_verde_scaduto || e == Evento::pulsante_prenotazione_premuto) return Stato::GIALLO;
+		break;
+	case Stato::GIALLO:
+		if (e == Evento::tempo_giallo_scaduto) return Stato::ROSSO;
+		break;
+	case Stato::ROSSO:
+		if (e == Evento::tempo_rosso_scaduto) return Stato::VERDE;
+		if (e == Evento::pulsante_prenotazione_premuto) return Stato::GIALLO;
+		break;
+	}
+	return s;
+}
+
+//------------------------------------------------------------------------------
+//=== PATTERN STATO ============================================================
+//------------------------------------------------------------------------------
+class StatoOO;
+
+class MacchinaOO {
+public:
+	StatoOO *statoCorrente = nullptr;
+	uint64_t transizioni = 0;
+	bool nuoviStati;   // true: new ad ogni transizione (come nel capitolo 3.2)
+
+	MacchinaOO(bool nuoviStati) : nuoviStati(nuoviStati) {}
+	~MacchinaOO();
+	void impostaStato(StatoOO *nuovo);
+	void gestisci(Evento e);
+};
+
+class StatoOO {
+public:
+	virtual ~StatoOO() {}
+	virtual Stato id() const = 0;
+	virtual void gestisciEvento(MacchinaOO *m, Evento e) = 0;
+};
+
+class StatoVerde : public StatoOO {
+public:
+	Stato id() const override { return Stato::VERDE; }
+	void gestisciEvento(MacchinaOO *m, Evento e) override;
+};
+
+class StatoGiallo : public StatoOO {
+public:
+	Stato id() const override { return Stato::GIALLO; }
+	void gestisciEvento(MacchinaOO *m, Evento e) override;
+};
+
+class StatoRosso : public StatoOO {
+public:
+	Stato id() const override { return Stato::ROSSO; }
+	void gestisciEvento(MacchinaOO *m, Evento e) override;
+};
+
+StatoVerde verde;
+StatoGiallo giallo;
+StatoRosso rosso;
+
+template <typename T>
+StatoOO *crea(MacchinaOO *m, T &unico) {
+	return m->nuoviStati ? static_cast<StatoOO *>(new T) : &unico;
+}
+
+void StatoVerde::gestisciEvento(MacchinaOO *m, Evento e) {
+	if (e == Evento::tempo_verde_scaduto || e == Evento::pulsante_prenotazione_premuto) m->impostaStato(crea(m, giallo));
+}
+
+void StatoGiallo::gestisciEvento(MacchinaOO *m, Evento e) {
+	if (e == Evento::tempo_giallo_scaduto) m->impostaStato(crea(m, rosso));
+}
+
+void StatoRosso::gestisciEvento(MacchinaOO *m, Evento e) {
+	if (e == Evento::tempo_rosso_scaduto) m->impostaStato(crea(m, verde));
+	else if (e == Evento::pulsante_prenotazione_premuto) m->impostaStato(crea(m, giallo));
+}
+
+void MacchinaOO::impostaStato(StatoOO *nuovo) {
+	if (nuoviStati) delete statoCorrente;
+	statoCorrente = nuovo;
+	transizioni++;
+}
+
+MacchinaOO::~MacchinaOO() {
+	if (nuoviStati) delete statoCorrente;
+}
+
+void MacchinaOO::gestisci(Evento e) {
+	statoCorrente->gestisciEvento(this, e);
+}
+
+//------------------------------------------------------------------------------
+//=== MISURA ===================================================================
+//------------------------------------------------------------------------------
+struct Risultato {
+	double secondi;
+	Stato finale;
+	uint64_t transizioni;
+};
+
+template <typename F>
+Risultato misura(F esegui) {
+	auto inizio = chrono::steady_clock::now();
+	Risultato r = esegui();
+	chrono::duration<double> t = chrono::steady_clock::now() - inizio;
+	r.secondi = t.count();
+	return r;
+}
+
+int main() {
+	const size_t N = 10000000;
+	mt19937 gen(42);
+	uniform_int_distribution<int> caso(0, (int)semaforo::NUM_EVENTI - 1);
+	vector<Evento> eventi(N);
+	for (auto &e : eventi) e = static_cast<Evento>(caso(gen));
+
+	Risultato tab = misura([&] {
+		fsm::Macchina<semaforo::tabella> m(semaforo::STATO_INIZIALE);
+		uint64_t n = 0;
+		for (Evento e : eventi) n += m.gestisci(e);
+		return Risultato{0, m.stato(), n};
+	});
+
+	Risultato sw = misura([&] {
+		Stato s = semaforo::STATO_INIZIALE;
+		uint64_t n = 0;
+		for (Evento e : eventi) {
+			Stato nuovo = prossimoSwitch(s, e);
+			n += nuovo != s;
+			s = nuovo;
+		}
+		return Risultato{0, s, n};
+	});
+
+	auto oo = [&](bool nuoviStati) {
+		return misura([&] {
+			MacchinaOO m(nuoviStati);
+			m.statoCorrente = nuoviStati ? new StatoVerde : &verde;
+			for (Evento e : eventi) m.gestisci(e);
+			return Risultato{0, m.statoCorrente->id(), m.transizioni};
+		});
+	};
+	Risultato ooNew = oo(true);
+	Risultato ooStatici = oo(false);
+
+	cout << "Semaforo: " << N << " eventi casuali\n";
+	cout << "versione                     Mev/s     transizioni  stato finale\n";
+	auto stampa = [&](const char *nome, const Risultato &r) {
+		cout << nome << N / r.secondi / 1e6 << "\t" << r.transizioni << "\t" << semaforo::nome(r.finale) << "\n";
+	};
+	stampa("tabella constexpr (FSM.h)    ", tab);
+	stampa("switch-case                  ", sw);
+	stampa("Pattern Stato (new)          ", ooNew);
+	stampa("Pattern Stato (statici)      ", ooStatici);
+
+	bool uguali = tab.finale == sw.finale && tab.finale == ooNew.finale && tab.finale == ooStatici.finale &&
+	              tab.transizioni == sw.transizioni && tab.transizioni == ooNew.transizioni &&
+	              tab.transizioni == ooStatici.transizioni;
+	cout << (uguali ? "Risultati identici\n" : "ERRORE: risultati diversi\n");
+	return uguali ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/** ****************************************************************************************
+* @file bench_fsm_batch.cpp
+* @brief Milioni di semafori: Macchina per istanza, EsecutoreBatch scalare, SIMD e con thread
+*
+* 1M istanze del semaforo ricevono 64 lotti di eventi casuali (un evento per
+* istanza per lotto). Le versioni devono arrivare agli stessi stati finali e
+* allo stesso numero di cambi di stato; per ognuna si stampano i milioni di
+* transizioni (eventi applicati) al secondo.
+* Il numero massimo di thread si può passare come argomento (default: tutti i core).
+*
+* Compilazione: g++ -std=c++20 -O2 -march=native -pthread bench_fsm_batch.cpp -o bench_fsm_batch
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>     // steady_clock
+#include <cstdint>    // uint64_t
+#include <iostream>   // cout
+#include <random>     // mt19937
+#include <string>     // string, to_string, stoi
+#include <thread>     // hardware_concurrency
+#include <vector>     // vector
+#include "FSMBatch.h"
+#include "Semaforo_fsm.h"
+
+using namespace std;
+using semaforo::Evento;
+using semaforo::Stato;
+using Esecutore = fsm::EsecutoreBatch<semaforo::tabella>;
+
+const size_t N = 1000000;
+const size_t LOTTI = 64;
+
+/// Esegue f e stampa i milioni di transizioni al secondo
+template <typename F>
+size_t misura(const char *nome, F f) {
+	auto inizio = chrono::steady_clock::now();
+	size_t cambi = f();
+	chrono::duration<double> t = chrono::steady_clock::now() - inizio;
+	cout << nome << N * LOTTI / t.count() / 1e6 << "\t" << cambi << "\n";
+	return cambi;
+}
+
+int main(int argc, char *argv[]) {
+	mt19937 gen(42);
+	uniform_int_distribution<int> caso(0, (int)semaforo::NUM_EVENTI - 1);
+	vector<Evento> eventi(N * LOTTI);
+	for (auto &e : eventi) e = static_cast<Evento>(caso(gen));
+
+	cout << N << " istanze x " << LOTTI << " lotti, SIMD: " << (Esecutore::vettoriale() ? "si" : "no") << "\n";
+	cout << "versione                       Mtrans/s   cambi di stato\n";
+
+	// Riferimento: un oggetto Macchina per istanza
+	vector<fsm::Macchina<semaforo::tabella>> macchine(N, fsm::Macchina<semaforo::tabella>(semaforo::STATO_INIZIALE));
+	size_t riferimento = misura("vector<Macchina>               ", [&] {
+		size_t cambi = 0;
+		for (size_t k = 0; k < LOTTI; k++) {
+			const Evento *lotto = eventi.data() + k * N;
+			for (size_t i = 0; i < N; i++) cambi += macchine[i].gestisci(lotto[i]);
+		}
+		return cambi;
+	});
+
+	bool ok = true;
+	auto verifica = [&](const Esecutore &b, size_t cambi) {
+		bool uguali = cambi == riferimento;
+		for (size_t i = 0; i < N && uguali; i++) uguali = b.stato(i) == macchine[i].stato();
+		if (!uguali) cout << "ERRORE: risultati diversi dal riferimento\n";
+		ok = ok && uguali;
+	};
+
+	Esecutore scalare(N, semaforo::STATO_INIZIALE);
+	verifica(scalare, misura("EsecutoreBatch scalare         ", [&] { return scalare.applicaScalare(eventi.data(), LOTTI); }));
+
+	unsigned massimo = argc > 1 ? (unsigned)stoi(argv[1]) : thread::hardware_concurrency();
+	for (unsigned t = 1; t == 1 || t <= massimo; t *= 2) {
+		Esecutore b(N, semaforo::STATO_INIZIALE);
+		string nome = "EsecutoreBatch SIMD " + to_string(t) + " thread";
+		nome.resize(31, ' ');
+		verifica(b, misura(nome.c_str(), [&] { return b.applica(eventi.data(), LOTTI, t); }));
+	}
+
+	cout << (ok ? "Risultati identici\n" : "ERRORE\n");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,292 @@
+/** ****************************************************************************************
+* @file bench_fsm_parallelo.cpp
+* @brief Regioni parallele: Esecutore lock-free (FSMParallelo.h) e "un thread + mutex per regione"
+*
+* Ogni regione è un braccio del robot del capitolo 8.3 con una macchina
+* gerarchica (capitolo 8.1):
+*   ATTIVO { IN_ATTESA (iniziale), IN_MOVIMENTO }, IN_CARICA, EMERGENZA
+* L'evento ALLARME è definito solo sullo stato composto ATTIVO e viene
+* ereditato dai sottostati; arriva come evento urgente (capitolo 8.2).
+*
+* Al crescere del numero di regioni si misurano:
+*  - throughput: un produttore invia 2M eventi casuali alle regioni a turno;
+*    alla fine gli stati devono coincidere con quelli di una Macchina sequenziale;
+*  - latenza: un evento alla volta (ping-pong), tempo tra l'invio e la fine
+*    della gestione; si stampano mediana e 99-esimo percentile.
+* Prima si verifica che un evento urgente passi davanti ai normali e che un
+* Esecutore con posto per 2 regioni rifiuti la terza e la quarta senza
+* perdere eventi delle prime due.
+* Il confronto è con l'approccio del capitolo 8.3: un thread per regione e una
+* coda protetta da std::mutex con std::condition_variable.
+* Il numero di worker si può passare come argomento (default: uno per core).
+*
+* Compilazione: g++ -std=c++20 -O2 -pthread bench_fsm_parallelo.cpp -o bench_fsm_parallelo
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>           // sort
+#include <atomic>              // atomic
+#include <chrono>              // steady_clock
+#include <condition_variable>  // condition_variable
+#include <cstdint>             // uint8_t, uint64_t
+#include <deque>               // deque
+#include <iostream>            // cout
+#include <memory>              // unique_ptr
+#include <mutex>               // mutex
+#include <random>              // mt19937
+#include <string>              // stoi
+#include <thread>              // thread
+#include <vector>              // vector
+#include "FSMParallelo.h"
+
+using namespace std;
+
+//------------------------------------------------------------------------------
+//=== MACCHINA GERARCHICA DEL BRACCIO ==========================================
+//------------------------------------------------------------------------------
+namespace robot {
+
+enum class Stato : uint8_t { ATTIVO, IN_ATTESA, IN_MOVIMENTO, IN_CARICA, EMERGENZA };
+enum class Evento : uint8_t { MUOVI, STOP, CARICA, CARICO, ALLARME, RESET };
+
+inline constexpr size_t NUM_STATI = 5;
+inline constexpr size_t NUM_EVENTI = 6;
+
+inline constexpr fsm::Sottostato<Stato> gerarchia[] = {
+	{Stato::IN_ATTESA, Stato::ATTIVO, true},
+	{Stato::IN_MOVIMENTO, Stato::ATTIVO, false},
+};
+
+inline constexpr fsm::Transizione<Stato, Evento> transizioni[] = {
+	{Stato::IN_ATTESA, Evento::MUOVI, Stato::IN_MOVIMENTO},
+	{Stato::IN_MOVIMENTO, Evento::STOP, Stato::IN_ATTESA},
+	{Stato::ATTIVO, Evento::CARICA, Stato::IN_CARICA},     // ereditata dai sottostati
+	{Stato::ATTIVO, Evento::ALLARME, Stato::EMERGENZA},
+	{Stato::IN_CARICA, Evento::CARICO, Stato::ATTIVO},     // entra in IN_ATTESA
+	{Stato::IN_CARICA, Evento::ALLARME, Stato::EMERGENZA},
+	{Stato::EMERGENZA, Evento::RESET, Stato::ATTIVO},
+};
+
+inline constexpr auto tabella = fsm::creaTabellaGerarchica<NUM_STATI, NUM_EVENTI>(transizioni, gerarchia);
+
+static_assert(tabella(Stato::IN_MOVIMENTO, Evento::ALLARME) == Stato::EMERGENZA);
+static_assert(tabella(Stato::EMERGENZA, Evento::RESET) == Stato::IN_ATTESA);
+
+} // namespace robot
+
+using Braccio = fsm::RegioneFSM<robot::tabella>;
+
+/// Braccio che conta gli eventi gestiti (per la latenza e per il test di priorità)
+class BraccioContato : public Braccio {
+public:
+	atomic<uint64_t> gestiti{0};
+	uint64_t posizioneUrgente = 0;   // quanti eventi erano già stati gestiti quando è arrivato l'urgente
+
+	BraccioContato() : Braccio(robot::Stato::IN_ATTESA) {}
+
+protected:
+	void gestisci(const fsm::Messaggio &m) override {
+		Braccio::gestisci(m);
+		uint64_t n = gestiti.load(memory_order_relaxed);
+		if (m.sorgente == 1) posizioneUrgente = n;
+		gestiti.store(n + 1, memory_order_release);   // un solo worker alla volta scrive
+	}
+};
+
+//------------------------------------------------------------------------------
+//=== VERSIONE DEL CAPITOLO 8.3: UN THREAD E UN MUTEX PER REGIONE ==============
+//------------------------------------------------------------------------------
+class BraccioThread {
+private:
+	fsm::Macchina<robot::tabella> macchina{robot::Stato::IN_ATTESA};
+	mutex mtx;
+	condition_variable cv;
+	deque<robot::Evento> coda;
+	bool fine = false;
+	thread t;
+
+	void ciclo() {
+		unique_lock<mutex> lk(mtx);
+		for (;;) {
+			cv.wait(lk, [this] { return fine || !coda.empty(); });
+			if (coda.empty()) return;      // fine e niente da gestire
+			robot::Evento e = coda.front();
+			coda.pop_front();
+			macchina.gestisci(e);
+			gestiti.store(gestiti.load(memory_order_relaxed) + 1, memory_order_release);
+		}
+	}
+
+public:
+	atomic<uint64_t> gestiti{0};
+
+	BraccioThread() : t([this] { ciclo(); }) {}
+
+	void invia(robot::Evento e) {
+		{
+			lock_guard<mutex> lk(mtx);
+			coda.push_back(e);
+		}
+		cv.notify_one();
+	}
+
+	void ferma() {
+		{
+			lock_guard<mutex> lk(mtx);
+			fine = true;
+		}
+		cv.notify_one();
+		if (t.joinable()) t.join();
+	}
+
+	robot::Stato stato() const {
+		return macchina.stato();
+	}
+
+	~BraccioThread() {
+		ferma();
+	}
+};
+
+//------------------------------------------------------------------------------
+//=== MISURE ===================================================================
+//------------------------------------------------------------------------------
+const size_t EVENTI = 2000000;
+const size_t CAMPIONI = 20000;
+
+double secondiDa(chrono::steady_clock::time_point inizio) {
+	return chrono::duration<double>(chrono::steady_clock::now() - inizio).count();
+}
+
+/// Mediana e 99-esimo percentile in microsecondi
+void stampaLatenza(vector<double> &lat) {
+	sort(lat.begin(), lat.end());
+	cout << "\t" << lat[lat.size() / 2] * 1e6 << "\t" << lat[lat.size() * 99 / 100] * 1e6;
+}
+
+/// Stato finale atteso di ogni regione, calcolato in sequenza
+vector<robot::Stato> atteso(const vector<robot::Evento> &ev, size_t regioni) {
+	vector<fsm::Macchina<robot::tabella>> m(regioni, fsm::Macchina<robot::tabella>(robot::Stato::IN_ATTESA));
+	for (size_t i = 0; i < ev.size(); i++) m[i % regioni].gestisci(ev[i]);
+	vector<robot::Stato> s;
+	for (auto &x : m) s.push_back(x.stato());
+	return s;
+}
+
+bool provaEsecutore(const vector<robot::Evento> &ev, size_t regioni, unsigned worker) {
+	vector<unique_ptr<BraccioContato>> r;
+	for (size_t i = 0; i < regioni; i++) r.push_back(make_unique<BraccioContato>());
+
+	// Throughput
+	fsm::Esecutore es(regioni);
+	es.avvia(worker);
+	auto inizio = chrono::steady_clock::now();
+	for (size_t i = 0; i < ev.size(); i++) {
+		while (!es.invia(*r[i % regioni], Braccio::messaggio(ev[i]))) this_thread::yield();  // casella piena
+	}
+	es.ferma();
+	double t = secondiDa(inizio);
+	vector<robot::Stato> fine = atteso(ev, regioni);
+	bool ok = true;
+	for (size_t i = 0; i < regioni; i++) ok = ok && r[i]->stato() == fine[i];
+
+	// Latenza (ping-pong)
+	es.avvia(worker);
+	vector<double> lat;
+	for (size_t i = 0; i < CAMPIONI; i++) {
+		BraccioContato &b = *r[i % regioni];
+		uint64_t prima = b.gestiti.load(memory_order_acquire);
+		auto t0 = chrono::steady_clock::now();
+		es.invia(b, Braccio::messaggio(robot::Evento::STOP));
+		while (b.gestiti.load(memory_order_acquire) == prima) this_thread::yield();
+		lat.push_back(secondiDa(t0));
+	}
+	es.ferma();
+
+	cout << regioni << "\tEsecutore (" << worker << " worker)\t" << ev.size() / t / 1e6;
+	stampaLatenza(lat);
+	cout << (ok ? "\n" : "\tERRORE: stati finali diversi\n");
+	return ok;
+}
+
+bool provaThread(const vector<robot::Evento> &ev, size_t regioni) {
+	vector<unique_ptr<BraccioThread>> r;
+	for (size_t i = 0; i < regioni; i++) r.push_back(make_unique<BraccioThread>());
+
+	vector<double> lat;
+	for (size_t i = 0; i < CAMPIONI; i++) {
+		BraccioThread &b = *r[i % regioni];
+		uint64_t prima = b.gestiti.load(memory_order_acquire);
+		auto t0 = chrono::steady_clock::now();
+		b.invia(robot::Evento::STOP);
+		while (b.gestiti.load(memory_order_acquire) == prima) this_thread::yield();
+		lat.push_back(secondiDa(t0));
+	}
+	// STOP non cambia lo stato iniziale IN_ATTESA: il throughput parte dallo stesso stato
+	auto inizio = chrono::steady_clock::now();
+	for (size_t i = 0; i < ev.size(); i++) r[i % regioni]->invia(ev[i]);
+	for (auto &b : r) b->ferma();
+	double t = secondiDa(inizio);
+
+	vector<robot::Stato> fine = atteso(ev, regioni);
+	bool ok = true;
+	for (size_t i = 0; i < regioni; i++) ok = ok && r[i]->stato() == fine[i];
+
+	cout << regioni << "\tthread + mutex\t\t" << ev.size() / t / 1e6;
+	stampaLatenza(lat);
+	cout << (ok ? "\n" : "\tERRORE: stati finali diversi\n");
+	return ok;
+}
+
+/// Un evento urgente inviato dopo 100 normali deve essere gestito per primo
+bool provaPriorita() {
+	BraccioContato b;
+	fsm::Esecutore es(1);
+	for (int i = 0; i < 100; i++) es.invia(b, Braccio::messaggio(robot::Evento::MUOVI));
+	fsm::Messaggio allarme = Braccio::messaggio(robot::Evento::ALLARME);
+	allarme.sorgente = 1;
+	es.invia(b, allarme, fsm::Priorita::URGENTE);
+	es.avvia(1);
+	es.ferma();
+	bool ok = b.posizioneUrgente == 0 && b.stato() == robot::Stato::EMERGENZA;
+	cout << "Evento urgente gestito per primo: " << (ok ? "si" : "NO") << "\n";
+	return ok;
+}
+
+/// Con più regioni che posti nell'Esecutore le regioni in più vengono rifiutate,
+/// e gli eventi delle altre non vanno persi
+bool provaCapacita() {
+	BraccioContato r[4];
+	fsm::Esecutore es(2);
+	bool ok = true;
+	for (int giro = 1; giro <= 2; giro++) {
+		for (int i = 0; i < 4; i++) ok = ok && es.invia(r[i], Braccio::messaggio(robot::Evento::STOP)) == (i < 2);
+		es.avvia(1);
+		es.ferma();
+		for (int i = 0; i < 4; i++) ok = ok && r[i].gestiti.load() == (i < 2 ? (uint64_t)giro : 0);
+	}
+	fsm::Esecutore altro(4);
+	ok = ok && !altro.invia(r[0], Braccio::messaggio(robot::Evento::STOP));   // regione di es
+	cout << "Regioni oltre la capacita' rifiutate, nessun evento perso: " << (ok ? "si" : "NO") << "\n";
+	return ok;
+}
+
+int main(int argc, char *argv[]) {
+	mt19937 gen(42);
+	uniform_int_distribution<int> caso(0, (int)robot::NUM_EVENTI - 1);
+	vector<robot::Evento> ev(EVENTI);
+	for (auto &e : ev) e = static_cast<robot::Evento>(caso(gen));
+
+	bool ok = provaPriorita();
+	ok = provaCapacita() && ok;
+	unsigned worker = argc > 1 ? (unsigned)stoi(argv[1]) : max(1u, thread::hardware_concurrency());
+	cout << EVENTI << " eventi, latenza su " << CAMPIONI << " campioni\n";
+	cout << "regioni\tversione\t\tMeventi/s\tlat. mediana us\tlat. 99% us\n";
+	for (size_t regioni : {1, 4, 16, 64, 256}) {
+		ok = provaEsecutore(ev, regioni, worker) && ok;
+		ok = provaThread(ev, regioni) && ok;
+	}
+	return ok ? 0 : 1;
+}
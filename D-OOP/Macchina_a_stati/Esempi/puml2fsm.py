@@ -0,0 +1,155 @@
+"""
+puml2fsm.py - Genera la tabella di transizione per FSM.h da un diagramma di stato PlantUML
+
+Utilizzo:
+    python3 puml2fsm.py Semaforo.puml [Semaforo_fsm.h]
+    python3 puml2fsm.py --verifica         controlla il riconoscimento delle frecce
+
+Righe riconosciute nel file .puml:
+    [*] --> STATO                  stato iniziale
+    DA --> A : evento              transizione (anche con ->, -right->, ecc.)
+    state NOME { ... }             dichiarazione di stato (il blocco viene appiattito)
+
+Il file generato contiene, nel namespace con il nome del diagramma in minuscolo:
+    enum class Stato, enum class Evento, STATO_INIZIALE, l'elenco delle
+    transizioni, la tabella constexpr e le funzioni nome(Stato), nome(Evento).
+Stati ed eventi sono numerati nell'ordine in cui compaiono nel diagramma.
+
+@author Filippo Bilardo
+@date 18/10/2026
+@version 1.0 18/10/2026 Versione iniziale
+"""
+import os
+import re
+import sys
+
+# DA --> A : evento   (anche ->; la freccia può contenere una direzione, es. -down->)
+RE_TRANSIZIONE = re.compile(r"^(\[\*\]|\w+)\s*(?:-+\w*-*)?->\s*(\w+)\s*(?::\s*(\w+))?\s*$")
+RE_STATO = re.compile(r"^state\s+(\w+)")
+
+
+def analizza(righe):
+    """Restituisce (stati, eventi, iniziale, transizioni) letti dalle righe del diagramma"""
+    stati, eventi, transizioni = [], [], []
+    iniziale = None
+
+    def aggiungi(elenco, nome):
+        if nome not in elenco:
+            elenco.append(nome)
+
+    for numero, riga in enumerate(righe, 1):
+        riga = riga.strip()
+        if not riga or riga.startswith("'") or riga.startswith("@") or riga == "}":
+            continue
+        m = RE_STATO.match(riga)
+        if m:
+            aggiungi(stati, m.group(1))
+            continue
+        m = RE_TRANSIZIONE.match(riga)
+        if not m:
+            print(f"riga {numero} ignorata: {riga}", file=sys.stderr)
+            continue
+        da, a, evento = m.groups()
+        aggiungi(stati, a)
+        if da == "[*]":
+            if iniziale is not None and iniziale != a:
+                sys.exit(f"riga {numero}: più di uno stato iniziale")
+            iniziale = a
+            continue
+        if evento is None:
+            sys.exit(f"riga {numero}: transizione {da} -> {a} senza evento")
+        aggiungi(stati, da)
+        aggiungi(eventi, evento)
+        transizioni.append((da, evento, a))
+
+    if iniziale is None:
+        sys.exit("manca lo stato iniziale ([*] --> STATO)")
+    return stati, eventi, iniziale, transizioni
+
+
+def genera(nome, stati, eventi, iniziale, transizioni, sorgente):
+    """Testo dell'header C++ da usare con FSM.h"""
+    ns = nome.lower()
+    guardia = nome.upper() + "_FSM_H"
+    righe = [
+        f"// File generato da puml2fsm.py a partire da {sorgente}: non modificare a mano",
+        f"#ifndef {guardia}",
+        f"#define {guardia}",
+        "",
+        "#include <cstdint>",
+        '#include "FSM.h"',
+        "",
+        f"namespace {ns} {{",
+        "",
+        "enum class Stato : uint8_t { " + ", ".join(stati) + " };",
+        "enum class Evento : uint8_t { " + ", ".join(eventi) + " };",
+        "",
+        f"inline constexpr size_t NUM_STATI = {len(stati)};",
+        f"inline constexpr size_t NUM_EVENTI = {len(eventi)};",
+        f"inline constexpr Stato STATO_INIZIALE = Stato::{iniziale};",
+        "",
+        "inline constexpr fsm::Transizione<Stato, Evento> transizioni[] = {",
+    ]
+    for da, evento, a in transizioni:
+        righe.append(f"\t{{Stato::{da}, Evento::{evento}, Stato::{a}}},")
+    righe += [
+        "};",
+        "",
+        "inline constexpr auto tabella = fsm::creaTabella<NUM_STATI, NUM_EVENTI>(transizioni);",
+        "",
+        "inline const char *nome(Stato s) {",
+        "\tstatic const char *nomi[] = { " + ", ".join(f'"{s}"' for s in stati) + " };",
+        "\treturn nomi[static_cast<size_t>(s)];",
+        "}",
+        "",
+        "inline const char *nome(Evento e) {",
+        "\tstatic const char *nomi[] = { " + ", ".join(f'"{e}"' for e in eventi) + " };",
+        "\treturn nomi[static_cast<size_t>(e)];",
+        "}",
+        "",
+        f"}} // namespace {ns}",
+        "",
+        "#endif",
+        "",
+    ]
+    return "\n".join(righe)
+
+
+# Righe di prova per --verifica: tutte le forme di freccia devono dare le stesse transizioni
+PROVA_FRECCE = [
+    "[*] -> A",
+    "A -> B : uno",
+    "B --> C : due",
+    "C -down-> A : tre",
+    "A --right--> C:quattro",
+]
+
+
+def verifica():
+    """Controlla che ->, -->, -down-> e --right--> siano riconosciute come transizioni"""
+    stati, eventi, iniziale, transizioni = analizza(PROVA_FRECCE)
+    atteso = [("A", "uno", "B"), ("B", "due", "C"), ("C", "tre", "A"), ("A", "quattro", "C")]
+    ok = iniziale == "A" and stati == ["A", "B", "C"] and transizioni == atteso
+    print("frecce ->, -->, -down->, --right-->: " + ("OK" if ok else f"ERRORE {transizioni}"))
+    return 0 if ok else 1
+
+
+def main():
+    if sys.argv[1:] == ["--verifica"]:
+        return verifica()
+    if len(sys.argv) not in (2, 3):
+        print(f"Utilizzo: {sys.argv[0]} DIAGRAMMA.puml [USCITA.h] | --verifica")
+        return 1
+    sorgente = sys.argv[1]
+    nome = os.path.splitext(os.path.basename(sorgente))[0]
+    uscita = sys.argv[2] if len(sys.argv) == 3 else nome + "_fsm.h"
+    with open(sorgente, encoding="utf-8") as f:
+        stati, eventi, iniziale, transizioni = analizza(f.readlines())
+    with open(uscita, "w", encoding="utf-8") as f:
+        f.write(genera(nome, stati, eventi, iniziale, transizioni, os.path.basename(sorgente)))
+    print(f"{uscita}: {len(stati)} stati, {len(eventi)} eventi, {len(transizioni)} transizioni")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,225 @@
+/** ****************************************************************************************
+* @file RTree.h
+* @brief Indice spaziale (R-tree) per trovare velocemente i rettangoli vicini
+*
+* Cercare "quali rettangoli intersecano q" confrontando q con tutti gli N
+* rettangoli costa O(N) per ogni ricerca. Un R-tree raggruppa i rettangoli
+* vicini in nodi, e ogni nodo conserva il riquadro (bounding box) che contiene
+* tutti i suoi figli: se il riquadro non interseca q, l'intero sottoalbero
+* viene scartato senza guardarlo.
+*
+* Costruzione in blocco con l'algoritmo STR (Sort-Tile-Recursive):
+*  1) si ordinano i rettangoli per x del centro e si dividono in S "fette"
+*     verticali, con S = radice quadrata del numero di foglie;
+*  2) ogni fetta si ordina per y del centro e si divide in gruppi di M:
+*     ogni gruppo diventa una foglia;
+*  3) si ripete sui riquadri delle foglie per costruire il livello superiore,
+*     finché resta un solo nodo (la radice).
+* I nodi sono (quasi) tutti pieni e stanno in un unico vector contiguo.
+*
+* Dentro un nodo i riquadri dei figli sono memorizzati come struttura di array
+* (tutti i minX, poi tutti i minY, ...): il confronto con q degli M figli
+* legge poche linee di cache consecutive.
+*
+* Ricerche disponibili: intersezione, contenimento (in entrambi i sensi) e
+* k rettangoli più vicini ad un punto. Le ricerche non usano la ricorsione.
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef RTREE_H
+#define RTREE_H
+
+#include <algorithm>  // sort, min
+#include <cmath>      // ceil, sqrt
+#include <cstdint>    // uint32_t
+#include <functional> // greater
+#include <queue>      // priority_queue
+#include <vector>     // vector
+#include "RettangoloPosizionato.h"
+
+class RTree {
+public:
+	static const int M = 16;   // figli per nodo
+
+private:
+	struct Nodo {
+		// Riquadri dei figli (struttura di array)
+		double minX[M], minY[M], maxX[M], maxY[M];
+		// Indice del figlio: nodo del livello inferiore oppure, nelle foglie, rettangolo
+		uint32_t figlio[M];
+		uint32_t n;
+		bool foglia;
+	};
+
+	/// Elemento da raggruppare durante la costruzione
+	struct Voce {
+		double minX, minY, maxX, maxY;
+		uint32_t id;
+	};
+
+	std::vector<Nodo> nodi;
+	uint32_t radice = 0;
+
+	/// Ordinamento STR di un livello: fette per x, poi y dentro ogni fetta
+	static void ordinaSTR(std::vector<Voce> &v) {
+		size_t foglie = (v.size() + M - 1) / M;
+		size_t fette = (size_t)std::ceil(std::sqrt((double)foglie));
+		size_t per_fetta = fette * M;
+		std::sort(v.begin(), v.end(), [](const Voce &a, const Voce &b) {
+			return a.minX + a.maxX < b.minX + b.maxX;
+		});
+		for (size_t i = 0; i < v.size(); i += per_fetta) {
+			auto fine = v.begin() + std::min(v.size(), i + per_fetta);
+			std::sort(v.begin() + i, fine, [](const Voce &a, const Voce &b) {
+				return a.minY + a.maxY < b.minY + b.maxY;
+			});
+		}
+	}
+
+	static double distanza2(double px, double py, double x0, double y0, double x1, double y1) {
+		double dx = px < x0 ? x0 - px : (px > x1 ? px - x1 : 0);
+		double dy = py < y0 ? y0 - py : (py > y1 ? py - y1 : 0);
+		return dx * dx + dy * dy;
+	}
+
+	/**
+	 * Visita l'albero scendendo solo nei nodi per cui scendi(nodo, j) è vero
+	 * e restituisce i rettangoli delle foglie per cui prendi(nodo, j) è vero.
+	 */
+	template <typename Scendi, typename Prendi>
+	std::vector<uint32_t> visita(Scendi scendi, Prendi prendi) const {
+		std::vector<uint32_t> risultato;
+		if (nodi.empty()) return risultato;
+		std::vector<uint32_t> pila;
+		pila.push_back(radice);
+		while (!pila.empty()) {
+			const Nodo &nd = nodi[pila.back()];
+			pila.pop_back();
+			if (nd.foglia) {
+				for (uint32_t j = 0; j < nd.n; j++) {
+					if (prendi(nd, j)) risultato.push_back(nd.figlio[j]);
+				}
+			} else {
+				for (uint32_t j = 0; j < nd.n; j++) {
+					if (scendi(nd, j)) pila.push_back(nd.figlio[j]);
+				}
+			}
+		}
+		return risultato;
+	}
+
+public:
+	/// Costruisce l'albero con l'algoritmo STR; gli indici restituiti dalle ricerche si riferiscono a r
+	explicit RTree(const std::vector<RettangoloPosizionato> &r) {
+		if (r.empty()) return;
+		std::vector<Voce> livello(r.size());
+		for (size_t i = 0; i < r.size(); i++) {
+			livello[i] = {r[i].GetX(), r[i].GetY(), r[i].GetXMax(), r[i].GetYMax(), (uint32_t)i};
+		}
+		nodi.reserve(r.size() / (M - 1) + 1);
+
+		bool foglia = true;
+		do {
+			ordinaSTR(livello);
+			std::vector<Voce> superiore;
+			for (size_t i = 0; i < livello.size(); i += M) {
+				Nodo nd{};
+				nd.foglia = foglia;
+				nd.n = (uint32_t)std::min<size_t>(M, livello.size() - i);
+				Voce riquadro = livello[i];
+				for (uint32_t j = 0; j < nd.n; j++) {
+					const Voce &v = livello[i + j];
+					nd.minX[j] = v.minX;
+					nd.minY[j] = v.minY;
+					nd.maxX[j] = v.maxX;
+					nd.maxY[j] = v.maxY;
+					nd.figlio[j] = v.id;
+					riquadro.minX = std::min(riquadro.minX, v.minX);
+					riquadro.minY = std::min(riquadro.minY, v.minY);
+					riquadro.maxX = std::max(riquadro.maxX, v.maxX);
+					riquadro.maxY = std::max(riquadro.maxY, v.maxY);
+				}
+				riquadro.id = (uint32_t)nodi.size();
+				nodi.push_back(nd);
+				superiore.push_back(riquadro);
+			}
+			livello.swap(superiore);
+			foglia = false;
+		} while (livello.size() > 1);
+		radice = livello[0].id;
+	}
+
+	/// Indici dei rettangoli che intersecano q
+	std::vector<uint32_t> intersezioni(const RettangoloPosizionato &q) const {
+		const double x0 = q.GetX(), y0 = q.GetY(), x1 = q.GetXMax(), y1 = q.GetYMax();
+		auto interseca = [=](const Nodo &nd, uint32_t j) {
+			return nd.minX[j] <= x1 && x0 <= nd.maxX[j] && nd.minY[j] <= y1 && y0 <= nd.maxY[j];
+		};
+		return visita(interseca, interseca);
+	}
+
+	/// Indici dei rettangoli interamente contenuti in q
+	std::vector<uint32_t> contenutiIn(const RettangoloPosizionato &q) const {
+		const double x0 = q.GetX(), y0 = q.GetY(), x1 = q.GetXMax(), y1 = q.GetYMax();
+		auto interseca = [=](const Nodo &nd, uint32_t j) {
+			return nd.minX[j] <= x1 && x0 <= nd.maxX[j] && nd.minY[j] <= y1 && y0 <= nd.maxY[j];
+		};
+		auto contenuto = [=](const Nodo &nd, uint32_t j) {
+			return x0 <= nd.minX[j] && nd.maxX[j] <= x1 && y0 <= nd.minY[j] && nd.maxY[j] <= y1;
+		};
+		return visita(interseca, contenuto);
+	}
+
+	/// Indici dei rettangoli che contengono interamente q
+	std::vector<uint32_t> contengono(const RettangoloPosizionato &q) const {
+		const double x0 = q.GetX(), y0 = q.GetY(), x1 = q.GetXMax(), y1 = q.GetYMax();
+		// Se un riquadro non contiene q, non lo può contenere nessun rettangolo al suo interno
+		auto contiene = [=](const Nodo &nd, uint32_t j) {
+			return nd.minX[j] <= x0 && x1 <= nd.maxX[j] && nd.minY[j] <= y0 && y1 <= nd.maxY[j];
+		};
+		return visita(contiene, contiene);
+	}
+
+	/**
+	 * @brief I k rettangoli più vicini al punto (px, py), dal più vicino
+	 *
+	 * Ricerca "best first": una coda con priorità contiene nodi e rettangoli
+	 * ordinati per distanza minima dal punto. Il riquadro di un nodo non è mai
+	 * più lontano dei rettangoli che contiene, quindi quando un rettangolo
+	 * esce dalla coda nessun elemento ancora in coda può essere più vicino.
+	 */
+	std::vector<uint32_t> kPiuVicini(double px, double py, size_t k) const {
+		struct Elemento {
+			double d2;
+			uint32_t id;
+			bool rettangolo;
+			bool operator>(const Elemento &e) const { return d2 > e.d2; }
+		};
+		std::vector<uint32_t> risultato;
+		if (nodi.empty() || k == 0) return risultato;
+		std::priority_queue<Elemento, std::vector<Elemento>, std::greater<Elemento>> coda;
+		coda.push({0, radice, false});
+		while (!coda.empty() && risultato.size() < k) {
+			Elemento e = coda.top();
+			coda.pop();
+			if (e.rettangolo) {
+				risultato.push_back(e.id);
+				continue;
+			}
+			const Nodo &nd = nodi[e.id];
+			for (uint32_t j = 0; j < nd.n; j++) {
+				double d2 = distanza2(px, py, nd.minX[j], nd.minY[j], nd.maxX[j], nd.maxY[j]);
+				coda.push({d2, nd.figlio[j], nd.foglia});
+			}
+		}
+		return risultato;
+	}
+
+	size_t numeroNodi() const {
+		return nodi.size();
+	}
+};
+
+#endif
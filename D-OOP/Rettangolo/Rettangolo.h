@@ -0,0 +1,77 @@
+/**************************************************************************************************************
+* @brief Classe Rettangolo: base, altezza, area, perimetro e diagonale                                       *
+* <specifiche del progetto>                                                                                   *
+* <specifiche del collaudo>                                                                                   *
+* @author SIMONE ACCONCIA 4^H                                                                                 *
+* @date 19/01/2023	                                                                                          *
+*/
+#ifndef RETTANGOLO_H
+#define RETTANGOLO_H
+
+#include <math.h>		
+
+class Rettangolo
+{
+	private:
+	double base;
+	double altezza;
+	
+	public: 
+	
+	//metodi costruttori
+	
+	Rettangolo()	//inizializza gli attributi privati ad uno
+	{
+		base=1;
+		altezza=1;
+	}
+	
+	Rettangolo(double b ,double a)
+	{
+		base=b;
+		altezza=a;
+	}
+	
+	//metodi get e setter
+	
+	void SetAltezza(double a)
+	{
+		altezza =a;
+	}
+	
+	void SetBase(double b)
+	{
+		base = b;
+	}
+	
+	
+	double GetAltezza () const
+	{
+		return altezza;
+	}
+	
+	double GetBase () const
+	{
+		return base; 
+	}
+	
+	//metodi per calcolare area,perimetro,diagonale
+	
+	double CalcolaPerimetro() const //USO GLI ATTRIBUTI E NON PARAMETRI  perchè lavoro sugli oggetti
+	{
+		return (altezza)*2+(base)*2;
+	}
+	
+	double CalcolaArea() const
+	{
+		return (base*altezza);
+	}
+	
+	double calcolaDiagonale() const
+	{
+		return sqrt(base*base+altezza*altezza);
+	}
+	
+};
+
+#endif
@@ -0,0 +1,135 @@
+/** ****************************************************************************************
+* @file RettangoloBatch.h
+* @brief Calcolo di area, perimetro e diagonale su milioni di rettangoli
+*
+* Con un vector<Rettangolo> i dati in memoria sono alternati (base, altezza,
+* base, altezza, ...) e ogni misura viene calcolata un oggetto alla volta.
+* RettangoloBatch memorizza tutte le basi in un array e tutte le altezze in un
+* altro (struttura di array, SoA): così i calcoli possono essere eseguiti con le
+* istruzioni SIMD, che elaborano più double con una sola istruzione
+* (4 con AVX2, 8 con AVX-512).
+*
+* Le funzioni di calcolo usano std::experimental::simd (GCC >= 11): il codice
+* è lo stesso per qualsiasi set di istruzioni, è il compilatore a scegliere la
+* larghezza dei registri in base a -march. Se l'header non è disponibile si usa
+* un normale ciclo scalare.
+*
+* Compilazione: g++ -std=c++20 -O2 -march=native programma.cpp
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef RETTANGOLO_BATCH_H
+#define RETTANGOLO_BATCH_H
+
+#include <cmath>      // sqrt
+#include <cstddef>    // size_t
+#include <span>       // span
+#include <stdexcept>  // invalid_argument
+#include <vector>     // vector
+#include "Rettangolo.h"
+
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define RETTANGOLO_SIMD 1
+#endif
+
+class RettangoloBatch {
+private:
+	std::vector<double> basi;
+	std::vector<double> altezze;
+
+	/**
+	 * Applica op(base, altezza) a tutti i rettangoli e scrive i risultati in out.
+	 * op è una lambda generica: viene chiamata sia con vettori SIMD (blocchi di
+	 * rettangoli) sia con double (rettangoli rimasti alla fine).
+	 */
+	template <typename Op>
+	void applica(std::span<double> out, Op op) const {
+		if (out.size() < basi.size()) {
+			throw std::invalid_argument("RettangoloBatch: array dei risultati troppo piccolo");
+		}
+		const size_t n = basi.size();
+		const double *b = basi.data();
+		const double *a = altezze.data();
+		double *r = out.data();
+		size_t i = 0;
+#ifdef RETTANGOLO_SIMD
+		namespace stdx = std::experimental;
+		using V = stdx::native_simd<double>;
+		for (; i + V::size() <= n; i += V::size()) {
+			V vb(b + i, stdx::element_aligned);
+			V va(a + i, stdx::element_aligned);
+			op(vb, va).copy_to(r + i, stdx::element_aligned);
+		}
+#endif
+		for (; i < n; i++) {
+			r[i] = op(b[i], a[i]);
+		}
+	}
+
+public:
+	void aggiungi(const Rettangolo &r) {
+		basi.push_back(r.GetBase());
+		altezze.push_back(r.GetAltezza());
+	}
+
+	void aggiungi(double b, double a) {
+		basi.push_back(b);
+		altezze.push_back(a);
+	}
+
+	void reserve(size_t n) {
+		basi.reserve(n);
+		altezze.reserve(n);
+	}
+
+	size_t size() const {
+		return basi.size();
+	}
+
+	Rettangolo operator[](size_t i) const {
+		return Rettangolo(basi[i], altezze[i]);
+	}
+
+	/// Aree di tutti i rettangoli (out deve avere almeno size() elementi)
+	void calcolaAree(std::span<double> out) const {
+		applica(out, [](auto b, auto a) { return b * a; });
+	}
+
+	/// Perimetri di tutti i rettangoli
+	void calcolaPerimetri(std::span<double> out) const {
+		applica(out, [](auto b, auto a) { return (b + a) * 2.0; });
+	}
+
+	/// Diagonali di tutti i rettangoli (radice quadrata vettoriale)
+	void calcolaDiagonali(std::span<double> out) const {
+		applica(out, [](auto b, auto a) {
+			using std::sqrt;  // per i vettori SIMD viene scelta la sqrt di std::experimental
+			return sqrt(b * b + a * a);
+		});
+	}
+
+	/// Somma delle aree, senza array intermedio
+	double areaTotale() const {
+		const size_t n = basi.size();
+		size_t i = 0;
+		double totale = 0;
+#ifdef RETTANGOLO_SIMD
+		namespace stdx = std::experimental;
+		using V = stdx::native_simd<double>;
+		V somma = 0.0;
+		for (; i + V::size() <= n; i += V::size()) {
+			somma += V(basi.data() + i, stdx::element_aligned) * V(altezze.data() + i, stdx::element_aligned);
+		}
+		totale = stdx::reduce(somma);
+#endif
+		for (; i < n; i++) {
+			totale += basi[i] * altezze[i];
+		}
+		return totale;
+	}
+};
+
+#endif
@@ -0,0 +1,60 @@
+/** ****************************************************************************************
+* @file RettangoloPosizionato.h
+* @brief Rettangolo con una posizione nel piano (lati paralleli agli assi)
+*
+* Un RettangoloPosizionato "è un" Rettangolo (ereditarietà pubblica) a cui si
+* aggiungono le coordinate (x, y) del vertice in basso a sinistra. Il rettangolo
+* occupa quindi [x, x + base] x [y, y + altezza].
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef RETTANGOLO_POSIZIONATO_H
+#define RETTANGOLO_POSIZIONATO_H
+
+#include "Rettangolo.h"
+
+class RettangoloPosizionato : public Rettangolo {
+	private:
+	double x;
+	double y;
+
+	public:
+	RettangoloPosizionato() : Rettangolo(), x(0), y(0) {}
+
+	RettangoloPosizionato(double x, double y, double b, double a) : Rettangolo(b, a), x(x), y(y) {}
+
+	double GetX() const { return x; }
+	double GetY() const { return y; }
+	double GetXMax() const { return x + GetBase(); }
+	double GetYMax() const { return y + GetAltezza(); }
+
+	void SetPosizione(double nx, double ny)
+	{
+		x = nx;
+		y = ny;
+	}
+
+	/// true se i due rettangoli hanno almeno un punto in comune (bordo compreso)
+	bool Interseca(const RettangoloPosizionato &r) const
+	{
+		return x <= r.GetXMax() && r.x <= GetXMax() && y <= r.GetYMax() && r.y <= GetYMax();
+	}
+
+	/// true se r è interamente contenuto in questo rettangolo
+	bool Contiene(const RettangoloPosizionato &r) const
+	{
+		return x <= r.x && r.GetXMax() <= GetXMax() && y <= r.y && r.GetYMax() <= GetYMax();
+	}
+
+	/// Quadrato della distanza tra il punto (px, py) e il rettangolo (0 se il punto è interno)
+	double Distanza2(double px, double py) const
+	{
+		double dx = px < x ? x - px : (px > GetXMax() ? px - GetXMax() : 0);
+		double dy = py < y ? y - py : (py > GetYMax() ? py - GetYMax() : 0);
+		return dx * dx + dy * dy;
+	}
+};
+
+#endif
@@ -0,0 +1,72 @@
+/** ****************************************************************************************
+* @file bench_rettangolo.cpp
+* @brief Confronto tra vector<Rettangolo> e RettangoloBatch su 10 milioni di rettangoli
+*
+* Compilazione: g++ -std=c++20 -O2 -march=native bench_rettangolo.cpp -o bench_rettangolo
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>     // steady_clock
+#include <cmath>      // fabs
+#include <iostream>   // cout
+#include <random>     // mt19937
+#include <vector>     // vector
+#include "RettangoloBatch.h"
+
+using namespace std;
+
+template <typename F>
+double misura(F f) {
+	const int RIPETIZIONI = 10;
+	auto inizio = chrono::steady_clock::now();
+	for (int r = 0; r < RIPETIZIONI; r++) f();
+	chrono::duration<double, milli> t = chrono::steady_clock::now() - inizio;
+	return t.count() / RIPETIZIONI;
+}
+
+int main() {
+	const size_t N = 10000000;
+	mt19937 gen(1);
+	uniform_real_distribution<double> dim(0.1, 100.0);
+
+	vector<Rettangolo> oggetti;
+	RettangoloBatch batch;
+	oggetti.reserve(N);
+	batch.reserve(N);
+	for (size_t i = 0; i < N; i++) {
+		Rettangolo r(dim(gen), dim(gen));
+		oggetti.push_back(r);
+		batch.aggiungi(r);
+	}
+
+	vector<double> r1(N), r2(N);
+	auto verifica = [&] {
+		for (size_t i = 0; i < N; i++) {
+			if (fabs(r1[i] - r2[i]) > 1e-9 * fabs(r1[i])) return " ERRORE";
+		}
+		return "";
+	};
+
+	cout << "Tempo medio in ms per " << N << " rettangoli\n";
+	cout << "misura       oggetti   batch\n";
+
+	double t1 = misura([&] { for (size_t i = 0; i < N; i++) r1[i] = oggetti[i].CalcolaArea(); });
+	double t2 = misura([&] { batch.calcolaAree(r2); });
+	cout << "area         " << t1 << "   " << t2 << verifica() << "\n";
+
+	t1 = misura([&] { for (size_t i = 0; i < N; i++) r1[i] = oggetti[i].CalcolaPerimetro(); });
+	t2 = misura([&] { batch.calcolaPerimetri(r2); });
+	cout << "perimetro    " << t1 << "   " << t2 << verifica() << "\n";
+
+	t1 = misura([&] { for (size_t i = 0; i < N; i++) r1[i] = oggetti[i].calcolaDiagonale(); });
+	t2 = misura([&] { batch.calcolaDiagonali(r2); });
+	cout << "diagonale    " << t1 << "   " << t2 << verifica() << "\n";
+
+	double s1 = 0, s2 = 0;
+	t1 = misura([&] { s1 = 0; for (size_t i = 0; i < N; i++) s1 += oggetti[i].CalcolaArea(); });
+	t2 = misura([&] { s2 = batch.areaTotale(); });
+	cout << "area totale  " << t1 << "   " << t2 << (fabs(s1 - s2) > 1e-9 * s1 ? " ERRORE" : "") << "\n";
+	return 0;
+}
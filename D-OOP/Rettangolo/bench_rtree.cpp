@@ -0,0 +1,110 @@
+/** ****************************************************************************************
+* @file bench_rtree.cpp
+* @brief Ricerche su 1 milione di rettangoli: R-tree contro ricerca esaustiva
+*
+* Per ogni tipo di ricerca si controlla che l'R-tree restituisca esattamente
+* gli stessi rettangoli della ricerca esaustiva (confronto di tutti gli N).
+*
+* Compilazione: g++ -std=c++17 -O2 bench_rtree.cpp -o bench_rtree
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>  // sort, partial_sort
+#include <chrono>     // steady_clock
+#include <iostream>   // cout
+#include <random>     // mt19937
+#include <vector>     // vector
+#include "RTree.h"
+
+using namespace std;
+
+template <typename F>
+double misura(F f) {
+	auto inizio = chrono::steady_clock::now();
+	f();
+	chrono::duration<double, milli> t = chrono::steady_clock::now() - inizio;
+	return t.count();
+}
+
+int main() {
+	const size_t N = 1000000;
+	const int RICERCHE = 200;
+	const double LATO = 10000;
+	mt19937 gen(3);
+	uniform_real_distribution<double> pos(0, LATO), dim(1, 50), grande(200, 2000);
+
+	vector<RettangoloPosizionato> r(N);
+	for (auto &x : r) x = RettangoloPosizionato(pos(gen), pos(gen), dim(gen), dim(gen));
+
+	RTree albero({});
+	double t = misura([&] { albero = RTree(r); });
+	cout << "Costruzione STR di " << N << " rettangoli: " << t << " ms, " << albero.numeroNodi() << " nodi\n\n";
+
+	vector<RettangoloPosizionato> q(RICERCHE);
+	for (auto &x : q) x = RettangoloPosizionato(pos(gen), pos(gen), grande(gen), grande(gen));
+
+	// Per confrontare i risultati dell'albero con quelli esaustivi li ordino
+	auto ordinato = [](vector<uint32_t> v) { sort(v.begin(), v.end()); return v; };
+	bool ok = true;
+	size_t trovati = 0;
+
+	cout << "ricerca (" << RICERCHE << " volte)   R-tree ms   esaustiva ms\n";
+	vector<vector<uint32_t>> ra(RICERCHE), rb(RICERCHE);
+
+	double ta = misura([&] { for (int i = 0; i < RICERCHE; i++) ra[i] = albero.intersezioni(q[i]); });
+	double tb = misura([&] {
+		for (int i = 0; i < RICERCHE; i++) {
+			rb[i].clear();
+			for (uint32_t j = 0; j < N; j++) if (r[j].Interseca(q[i])) rb[i].push_back(j);
+		}
+	});
+	for (int i = 0; i < RICERCHE; i++) { ok = ok && ordinato(ra[i]) == rb[i]; trovati += rb[i].size(); }
+	cout << "intersezione            " << ta << "   " << tb << "   (" << trovati / RICERCHE << " risultati in media)\n";
+
+	ta = misura([&] { for (int i = 0; i < RICERCHE; i++) ra[i] = albero.contenutiIn(q[i]); });
+	tb = misura([&] {
+		for (int i = 0; i < RICERCHE; i++) {
+			rb[i].clear();
+			for (uint32_t j = 0; j < N; j++) if (q[i].Contiene(r[j])) rb[i].push_back(j);
+		}
+	});
+	for (int i = 0; i < RICERCHE; i++) ok = ok && ordinato(ra[i]) == rb[i];
+	cout << "contenuti in q          " << ta << "   " << tb << "\n";
+
+	// Rettangoli piccoli da cercare dentro quelli esistenti
+	vector<RettangoloPosizionato> piccoli(RICERCHE);
+	for (auto &x : piccoli) x = RettangoloPosizionato(pos(gen), pos(gen), 0.5, 0.5);
+	ta = misura([&] { for (int i = 0; i < RICERCHE; i++) ra[i] = albero.contengono(piccoli[i]); });
+	tb = misura([&] {
+		for (int i = 0; i < RICERCHE; i++) {
+			rb[i].clear();
+			for (uint32_t j = 0; j < N; j++) if (r[j].Contiene(piccoli[i])) rb[i].push_back(j);
+		}
+	});
+	for (int i = 0; i < RICERCHE; i++) ok = ok && ordinato(ra[i]) == rb[i];
+	cout << "che contengono q        " << ta << "   " << tb << "\n";
+
+	const size_t K = 10;
+	ta = misura([&] { for (int i = 0; i < RICERCHE; i++) ra[i] = albero.kPiuVicini(q[i].GetX(), q[i].GetY(), K); });
+	tb = misura([&] {
+		vector<pair<double, uint32_t>> d(N);
+		for (int i = 0; i < RICERCHE; i++) {
+			for (uint32_t j = 0; j < N; j++) d[j] = {r[j].Distanza2(q[i].GetX(), q[i].GetY()), j};
+			partial_sort(d.begin(), d.begin() + K, d.end());
+			rb[i].clear();
+			for (size_t j = 0; j < K; j++) rb[i].push_back(d[j].second);
+		}
+	});
+	// A parità di distanza l'ordine può cambiare: confronto le distanze
+	for (int i = 0; i < RICERCHE; i++) {
+		for (size_t j = 0; j < K; j++) {
+			ok = ok && r[ra[i][j]].Distanza2(q[i].GetX(), q[i].GetY()) == r[rb[i][j]].Distanza2(q[i].GetX(), q[i].GetY());
+		}
+	}
+	cout << "k = " << K << " più vicini       " << ta << "   " << tb << "\n";
+
+	cout << "\nRisultati uguali alla ricerca esaustiva: " << (ok ? "OK" : "ERRORE") << "\n";
+	return ok ? 0 : 1;
+}
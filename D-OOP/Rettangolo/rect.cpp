@@ -7,79 +7,15 @@
 */
 
 #include <iostream>	
-#include <math.h>		
+#include "Rettangolo.h"
 using namespace std;
 
-class Rettangolo
-{
-	private:
-	double base;
-	double altezza;
-	
-	public: 
-	
-	//metodi costruttori
-	
-	Rettangolo()	//inizializza gli attributi privati ad uno
-	{
-		base=1;
-		altezza=1;
-	}
-	
-	Rettangolo(double b ,double a)
-	{
-		base=b;
-		altezza=a;
-	}
-	
-	//metodi get e setter
-	
-	void SetAltezza(double a)
-	{
-		altezza =a;
-	}
-	
-	void SetBase(double b)
-	{
-		base = b;
-	}
-	
-	
-	double GetAltezza ()
-	{
-		return altezza;
-	}
-	
-	double GetBase ()
-	{
-		return base; 
-	}
-	
-	//metodi per calcolare area,perimetro,diagonale
-	
-	double CalcolaPerimetro() //USO GLI ATTRIBUTI E NON PARAMETRI  perchè lavoro sugli oggetti
-	{
-		return (altezza)*2+(base)*2;
-	}
-	
-	double CalcolaArea()
-	{
-		return (base*altezza);
-	}
-	
-	double calcolaDiagonale()
-	{
-		return sqrt(base*base+altezza*altezza);
-	}
-	
-};
-
-
 int main()
 {
 	Rettangolo r1;
 	//Rettangolo r2;
 	//double r;
+	double b, a;
 	
 	r1.SetAltezza(5);
 	r1.SetBase(12);
@@ -92,5 +28,5 @@ int main()
 	cin>>a;
 	Rettangolo r2(b,a);
 	cout<<"base del secondo  rettangolo:"<<r2.GetBase()<<endl;
-	cout<<"altezza del secondo rettangolo:"<<r2.GetAltezza()<endl;
+	cout<<"altezza del secondo rettangolo:"<<r2.GetAltezza()<<endl;
 }
@@ -0,0 +1,257 @@
+/** ****************************************************************************************
+* @file 01_bench_hash_index.cpp
+* @brief LinkedList con e senza indice hash (HashIndex) su 10M elementi
+*
+* 1) Verifica: 200000 operazioni casuali (tutti gli inserimenti e le
+*    cancellazioni di LinkedList, deleteValue, contains, search) su una lista
+*    con indice, confrontata con un std::vector; ogni 1000 operazioni si
+*    controlla che l'indice corrisponda esattamente alla lista. Poi 100000
+*    inserimenti, deleteValue e contains con solo 10 valori diversi, confrontati
+*    con il numero di nodi di ogni valore.
+* 2) ns per operazione con N elementi (valori casuali a 32 bit):
+*    - insertAtBeginning (costruzione della lista);
+*    - contains di valori presenti e assenti;
+*    - deleteValue di valori presenti;
+*    per confronto, contains su un std::unordered_set con gli stessi valori.
+*    Senza indice contains e deleteValue percorrono la lista: vengono misurate
+*    su poche operazioni.
+* 3) Valori ripetuti: 200000 insertAtBeginning con 10 valori diversi, poi
+*    deleteValue di tutti gli elementi, con e senza indice.
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 01_bench_hash_index.cpp -o bench_hash_index
+*   ./bench_hash_index [N, default 10000000]
+* (10M elementi con indice richiedono circa 1.5 GB di RAM)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unordered_set>
+#include <vector>
+#include "01_cpp_linked_list.h"
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verify() {
+    std::mt19937 gen(5);
+    LinkedList list;
+    list.enableIndex();
+    std::vector<int> ref;   // stesso contenuto, nello stesso ordine
+    const int KEYS = 3000;
+    for (int op = 0; op < 200000; op++) {
+        int kind = gen() % 12, key = gen() % KEYS;
+        int n = (int)ref.size();
+        auto it = std::find(ref.begin(), ref.end(), key);
+        bool present = it != ref.end();
+        if (op == 50000) {
+            list.enableIndex();   // ricostruito su una lista già piena
+        }
+        if (kind < 4 || n == 0) {
+            if (present) continue;   // valori distinti: deleteValue toglie proprio quel nodo
+            int pos = kind < 2 ? 0 : kind == 2 ? n : gen() % (n + 1);
+            if (kind == 2) list.insertAtEnd(key);
+            else list.insertAtPosition(key, pos);
+            ref.insert(ref.begin() + pos, key);
+        } else if (kind == 4) {
+            list.deleteFromBeginning();
+            ref.erase(ref.begin());
+        } else if (kind == 5) {
+            list.deleteFromEnd();
+            ref.pop_back();
+        } else if (kind == 6) {
+            int pos = gen() % n;
+            list.deleteFromPosition(pos);
+            ref.erase(ref.begin() + pos);
+        } else if (kind < 9) {
+            if (list.deleteValue(key) != present) return false;
+            if (present) ref.erase(it);
+        } else {
+            int expected = present ? (int)(it - ref.begin()) : -1;
+            if (list.contains(key) != present || list.search(key) != expected) return false;
+        }
+        if (op % 1000 == 0 && !list.indexConsistent()) return false;
+    }
+    printf("Verifica: %zu elementi, ", ref.size());
+    return list.indexConsistent();
+}
+
+// Molti nodi con lo stesso valore: non si sa quale nodo toglie deleteValue,
+// quindi si confronta solo il numero di nodi di ogni valore
+static bool verifyDuplicates() {
+    std::mt19937 gen(6);
+    LinkedList list;
+    list.enableIndex();
+    const int KEYS = 10;
+    int count[KEYS] = {0}, n = 0;
+    for (int op = 0; op < 100000; op++) {
+        int kind = gen() % 10, key = gen() % KEYS;
+        if (op == 20000) {
+            list.enableIndex();
+        }
+        if (kind < 4) {
+            if (kind == 0) list.insertAtBeginning(key);
+            else if (kind == 1) list.insertAtEnd(key);
+            else list.insertAtPosition(key, gen() % (n + 1));
+            count[key]++;
+            n++;
+        } else if (kind < 8) {
+            if (list.deleteValue(key) != (count[key] > 0)) return false;
+            if (count[key] > 0) {
+                count[key]--;
+                n--;
+            }
+        } else {
+            if (list.contains(key) != (count[key] > 0) || (list.search(key) >= 0) != (count[key] > 0)) return false;
+        }
+        if (op % 1000 == 0 && !list.indexConsistent()) return false;
+    }
+    for (int key = 0; key < KEYS; key++) {
+        while (count[key] > 0) {
+            if (!list.deleteValue(key)) return false;
+            count[key]--;
+        }
+        if (list.deleteValue(key)) return false;
+    }
+    return list.indexConsistent() && !list.contains(0);
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+struct Times {
+    double insert;     // ns per insertAtBeginning
+    double present;    // ns per contains di un valore presente
+    double absent;     // ns per contains di un valore assente
+    double remove;     // ns per deleteValue
+};
+
+static Times timeList(const std::vector<int>& values, const std::vector<int>& absent, bool indexed) {
+    Times t;
+    LinkedList list;
+    if (indexed) list.enableIndex();
+    auto start = std::chrono::steady_clock::now();
+    for (int v : values) list.insertAtBeginning(v);
+    t.insert = seconds(start) / values.size() * 1e9;
+
+    std::mt19937 gen(9);
+    const int ops = indexed ? 1000000 : 10;
+    long found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) found += list.contains(values[gen() % values.size()]);
+    t.present = seconds(start) / ops * 1e9;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) found += list.contains(absent[i % absent.size()]);
+    t.absent = seconds(start) / ops * 1e9;
+    if (found != ops) {
+        printf("ERRORE: contains ha trovato %ld valori invece di %d\n", found, ops);
+        exit(1);
+    }
+
+    // i * 7919 % N: valori tutti diversi se N non è multiplo di 7919
+    const int removes = std::min(ops, (int)values.size());
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < removes; i++) {
+        if (!list.deleteValue(values[(size_t)i * 7919 % values.size()])) {
+            printf("ERRORE: deleteValue non trova un valore presente\n");
+            exit(1);
+        }
+    }
+    t.remove = seconds(start) / removes * 1e9;
+    return t;
+}
+
+// ns per insertAtBeginning e per deleteValue con n elementi e solo distinct valori diversi
+static Times timeDuplicates(int n, int distinct, bool indexed) {
+    Times t = {0, 0, 0, 0};
+    LinkedList list;
+    if (indexed) list.enableIndex();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) list.insertAtBeginning(i % distinct);
+    t.insert = seconds(start) / n * 1e9;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        if (!list.deleteValue(i % distinct)) {
+            printf("ERRORE: deleteValue non trova un valore presente\n");
+            exit(1);
+        }
+    }
+    t.remove = seconds(start) / n * 1e9;
+    return t;
+}
+
+static Times timeUnorderedSet(const std::vector<int>& values, const std::vector<int>& absent) {
+    Times t;
+    std::unordered_set<int> set;
+    auto start = std::chrono::steady_clock::now();
+    for (int v : values) set.insert(v);
+    t.insert = seconds(start) / values.size() * 1e9;
+    std::mt19937 gen(9);
+    const int ops = 1000000;
+    long found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) found += set.count(values[gen() % values.size()]);
+    t.present = seconds(start) / ops * 1e9;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) found += set.count(absent[i % absent.size()]);
+    t.absent = seconds(start) / ops * 1e9;
+    const int removes = std::min(ops, (int)values.size());
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < removes; i++) set.erase(values[(size_t)i * 7919 % values.size()]);
+    t.remove = seconds(start) / removes * 1e9;
+    if (found != ops) printf("ERRORE: ");
+    return t;
+}
+
+int main(int argc, char* argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    bool ok = verify();
+    printf("%s\n", ok ? "indice sempre coerente con la lista" : "ERRORE");
+    ok = verifyDuplicates() && ok;
+    printf("Verifica con valori ripetuti: %s\n\n", ok ? "numero di nodi di ogni valore corretto" : "ERRORE");
+    fflush(stdout);
+
+    // Misurati prima di creare e distruggere le liste grandi, che lasciano
+    // l'allocatore pieno di blocchi liberi
+    const int DUPLICATES = 200000, DISTINCT = 10;
+    Times plainDup = timeDuplicates(DUPLICATES, DISTINCT, false);
+    Times indexedDup = timeDuplicates(DUPLICATES, DISTINCT, true);
+
+    // Valori distinti: i pari sono nella lista, i dispari no
+    std::mt19937 gen(42);
+    std::unordered_set<int> distinct;
+    std::vector<int> values, absent;
+    while ((long)values.size() < n) {
+        int v = (int)(gen() & ~1u);
+        if (distinct.insert(v).second) values.push_back(v);
+    }
+    std::unordered_set<int>().swap(distinct);
+    for (int i = 0; i < 1000; i++) absent.push_back((int)(gen() | 1u));
+
+    Times plain = timeList(values, absent, false);
+    Times indexed = timeList(values, absent, true);
+    Times set = timeUnorderedSet(values, absent);
+
+    printf("ns per operazione, %ld elementi\n", n);
+    printf("%-28s %14s %14s %14s\n", "", "LinkedList", "con indice", "unordered_set");
+    printf("%-28s %14.1f %14.1f %14.1f\n", "insertAtBeginning / insert", plain.insert, indexed.insert, set.insert);
+    printf("%-28s %14.0f %14.1f %14.1f\n", "contains (presente)", plain.present, indexed.present, set.present);
+    printf("%-28s %14.0f %14.1f %14.1f\n", "contains (assente)", plain.absent, indexed.absent, set.absent);
+    printf("%-28s %14.0f %14.1f %14.1f\n", "deleteValue / erase", plain.remove, indexed.remove, set.remove);
+
+    printf("\nns per operazione, %d elementi con %d valori diversi\n", DUPLICATES, DISTINCT);
+    printf("%-28s %14s %14s\n", "", "LinkedList", "con indice");
+    printf("%-28s %14.1f %14.1f\n", "insertAtBeginning", plainDup.insert, indexedDup.insert);
+    printf("%-28s %14.1f %14.1f\n", "deleteValue", plainDup.remove, indexedDup.remove);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+/** ****************************************************************************************
+* @file 01_bench_list_sort.cpp
+* @brief Ordinamento di liste da 1M a 10M elementi: listMergeSort, listRadixSort,
+*        listParallelSort contro la copia in un std::vector ordinato con std::sort
+*
+* La lista è fatta di nodi come quelli di 01_c_linked_list.c (data, next), con
+* valori casuali. Per ogni metodo si controlla che il risultato sia ordinato,
+* contenga gli stessi valori e, per i metodi stabili, che i nodi con valori
+* uguali restino nell'ordine iniziale.
+*
+* "vector + std::sort" copia i valori in un vector, lo ordina e riscrive i
+* valori nei nodi nell'ordine della lista: è il modo più veloce quando il nodo
+* contiene solo la chiave, ma non sposta i nodi (i dati associati ad ogni
+* nodo resterebbero al loro posto) e richiede memoria per n valori.
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 -pthread 01_bench_list_sort.cpp -o bench_list_sort
+*   ./bench_list_sort [numero massimo di elementi, default 10000000] [thread, default tutti i core]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+#include "01_cpp_list_sort.h"
+
+// Nodo come in 01_c_linked_list.c, con il numero d'ordine iniziale per verificare la stabilità
+struct Node {
+    int data;
+    int order;
+    Node* next;
+};
+
+static int dataOf(const Node* n) {
+    return n->data;
+}
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static Node* vectorSort(Node* head) {
+    std::vector<int> values;
+    for (Node* x = head; x != nullptr; x = x->next) values.push_back(x->data);
+    std::sort(values.begin(), values.end());
+    size_t i = 0;
+    for (Node* x = head; x != nullptr; x = x->next) x->data = values[i++];
+    return head;
+}
+
+// Lista con i nodi in un array, collegati in ordine, con valori casuali in [0, range)
+static Node* build(std::vector<Node>& nodes, unsigned range, std::mt19937& gen) {
+    for (size_t i = 0; i < nodes.size(); i++) {
+        nodes[i].data = (int)(uint32_t)(gen() % range - range / 2);
+        nodes[i].order = (int)i;
+        nodes[i].next = i + 1 < nodes.size() ? &nodes[i + 1] : nullptr;
+    }
+    return &nodes[0];
+}
+
+static bool check(Node* head, size_t n, long long expectedSum, bool stable) {
+    size_t count = 0;
+    long long sum = 0;
+    for (Node* x = head; x != nullptr; x = x->next) {
+        Node* y = x->next;
+        if (y != nullptr && (y->data < x->data || (stable && y->data == x->data && y->order < x->order))) {
+            return false;
+        }
+        sum += x->data;
+        count++;
+    }
+    return count == n && sum == expectedSum;
+}
+
+int main(int argc, char* argv[]) {
+    long max = argc > 1 ? atol(argv[1]) : 10000000;
+    int threads = argc > 2 ? atoi(argv[2]) : (int)std::thread::hardware_concurrency();
+    if (threads < 1) threads = 1;
+    bool ok = true;
+
+    struct Method {
+        const char* name;
+        bool stable;
+        int threads;
+    } methods[] = {
+        {"vector + std::sort", false, 1},
+        {"listMergeSort", true, 1},
+        {"listRadixSort", true, 1},
+        {"listParallelSort", true, threads},
+        {"listParallelSort", true, 4},
+    };
+
+    std::mt19937 gen(42);
+    printf("Secondi per ordinare una lista (%u core)\n", std::thread::hardware_concurrency());
+    printf("%-22s %-8s", "metodo", "thread");
+    for (long n = 1000000; n <= max; n *= 10) {
+        printf("  %6ldM ", n / 1000000);
+        printf("  %6ldM*", n / 1000000);
+    }
+    printf("\n(* = valori in un intervallo piccolo, 0-999: molte chiavi uguali)\n");
+    for (const Method& m : methods) {
+        printf("%-22s %-8d", m.name, m.threads);
+        for (long n = 1000000; n <= max; n *= 10) {
+            const unsigned ranges[] = {0xFFFFFFFFu, 1000};
+            for (unsigned range : ranges) {
+                std::vector<Node> nodes(n);
+                Node* head = build(nodes, range, gen);
+                long long sum = 0;
+                for (const Node& x : nodes) sum += x.data;
+
+                auto start = std::chrono::steady_clock::now();
+                if (m.name[0] == 'v') head = vectorSort(head);
+                else if (m.name[4] == 'M') head = listMergeSort(head, dataOf);
+                else if (m.name[4] == 'R') head = listRadixSort(head, dataOf);
+                else head = listParallelSort(head, dataOf, m.threads);
+                double t = seconds(start);
+
+                bool good = check(head, n, sum, m.stable);
+                ok = ok && good;
+                printf("  %8.3f%s", t, good ? "" : " ERRORE");
+                fflush(stdout);
+            }
+        }
+        printf("\n");
+    }
+    return ok ? 0 : 1;
+}
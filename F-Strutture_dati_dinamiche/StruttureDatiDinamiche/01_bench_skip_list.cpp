@@ -0,0 +1,273 @@
+/** ****************************************************************************************
+* @file 01_bench_skip_list.cpp
+* @brief Operazioni in posizioni casuali: lista normale, UnrolledLinkedList e IndexableSkipList
+*
+* 1) Verifica: 300000 operazioni casuali (insert, remove, removeAt, search, at)
+*    confrontate con un std::vector ordinato.
+* 2) Tempo per operazione con 10K, 100K e 1M elementi:
+*    - lettura dell'elemento in una posizione casuale;
+*    - cancellazione in una posizione casuale più un inserimento (la dimensione
+*      resta costante). Per le liste l'inserimento è insertAtPosition in una
+*      posizione casuale, per la skip list insert(chiave casuale), che finisce
+*      nella sua posizione in ordine.
+* 3) Letture concorrenti: 1, 2 e 4 thread fanno at() e search() su 1M elementi
+*    per 1 secondo mentre un thread scrive (remove + insert), senza lock per i
+*    lettori e, per confronto, con un mutex condiviso da lettori e scrittore.
+*    I lettori controllano i risultati: le chiavi multiple di 4 non vengono mai
+*    tolte e devono essere sempre trovate, tutte le chiavi sono pari. Per la
+*    versione senza lock si stampa anche il massimo dei nodi tolti e non ancora
+*    liberati: resta limitato anche con i lettori sempre attivi, perché dipende
+*    da quanto dura una lettura e non da quanto dura la prova.
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 -march=native -pthread 01_bench_skip_list.cpp -o bench_skip_list
+*   ./bench_skip_list [numero massimo di elementi, default 1000000]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+#include "01_cpp_skip_list.h"
+#include "01_cpp_unrolled_linked_list.h"
+
+// Lista normale, come in 01_c_linked_list.c
+struct Node {
+    int data;
+    Node* next;
+};
+
+static Node* nodeAt(Node* head, int position) {
+    while (position-- > 0) head = head->next;
+    return head;
+}
+
+static Node* insertAtPosition(Node* head, int data, int position) {
+    Node* n = new Node{data, nullptr};
+    if (position == 0) {
+        n->next = head;
+        return n;
+    }
+    Node* prev = nodeAt(head, position - 1);
+    n->next = prev->next;
+    prev->next = n;
+    return head;
+}
+
+static Node* deleteFromPosition(Node* head, int position) {
+    Node* victim;
+    if (position == 0) {
+        victim = head;
+        head = head->next;
+    } else {
+        Node* prev = nodeAt(head, position - 1);
+        victim = prev->next;
+        prev->next = victim->next;
+    }
+    delete victim;
+    return head;
+}
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verify() {
+    std::mt19937 gen(3);
+    IndexableSkipList list;
+    std::vector<int> ref;   // ordinato
+    for (int op = 0; op < 300000; op++) {
+        int kind = gen() % 10;
+        int key = gen() % 5000;
+        if (kind < 5 || ref.empty()) {
+            int pos = list.insert(key);
+            auto it = std::upper_bound(ref.begin(), ref.end(), key);
+            if (pos != it - ref.begin()) return false;
+            ref.insert(it, key);
+        } else if (kind < 7) {
+            auto it = std::lower_bound(ref.begin(), ref.end(), key);
+            bool present = it != ref.end() && *it == key;
+            if (list.remove(key) != present) return false;
+            if (present) ref.erase(it);
+        } else if (kind < 8) {
+            int pos = gen() % ref.size();
+            if (!list.removeAt(pos)) return false;
+            ref.erase(ref.begin() + pos);
+        } else {
+            auto it = std::lower_bound(ref.begin(), ref.end(), key);
+            int expected = it != ref.end() && *it == key ? (int)(it - ref.begin()) : -1;
+            int pos = gen() % (ref.size() + 1), k = -1;
+            bool found = list.at(pos, &k);
+            if (list.search(key) != expected || found != (pos < (int)ref.size())) return false;
+            if (found && k != ref[pos]) return false;
+        }
+        if (list.size() != (int)ref.size()) return false;
+    }
+    printf("Verifica: %zu elementi, ", ref.size());
+    return true;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) OPERAZIONI IN POSIZIONI CASUALI ===================================================
+//------------------------------------------------------------------------------------------
+struct Times {
+    double read;     // ns per lettura
+    double update;   // ns per cancellazione + inserimento
+};
+
+static Times timePlain(int n, std::mt19937& gen) {
+    Node* head = nullptr;
+    for (int i = n - 1; i >= 0; i--) head = new Node{(int)(gen() % 1000000), head};
+    int ops = 20000000 / n + 20;
+    Times t;
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) sum += nodeAt(head, gen() % n)->data;
+    t.read = seconds(start) / ops * 1e9;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) {
+        head = deleteFromPosition(head, gen() % n);
+        head = insertAtPosition(head, gen() % 1000000, gen() % n);
+    }
+    t.update = seconds(start) / ops * 1e9;
+    while (head != nullptr) head = deleteFromPosition(head, 0);
+    if (sum == 42) printf(" ");
+    return t;
+}
+
+static Times timeUnrolled(int n, std::mt19937& gen) {
+    UnrolledLinkedList list;
+    for (int i = 0; i < n; i++) list.insertAtEnd(gen() % 1000000);
+    int ops = 200000000 / n + 20;
+    Times t;
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) sum += list.at(gen() % n);
+    t.read = seconds(start) / ops * 1e9;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) {
+        list.deleteFromPosition(gen() % n);
+        list.insertAtPosition(gen() % 1000000, gen() % n);
+    }
+    t.update = seconds(start) / ops * 1e9;
+    if (sum == 42) printf(" ");
+    return t;
+}
+
+static Times timeSkip(int n, std::mt19937& gen) {
+    IndexableSkipList list;
+    for (int i = 0; i < n; i++) list.insert(gen() % 1000000);
+    const int ops = 1000000;
+    Times t;
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) {
+        int k = 0;
+        list.at(gen() % n, &k);
+        sum += k;
+    }
+    t.read = seconds(start) / ops * 1e9;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ops; i++) {
+        list.removeAt(gen() % n);
+        list.insert(gen() % 1000000);
+    }
+    t.update = seconds(start) / ops * 1e9;
+    if (sum == 42) printf(" ");
+    return t;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 3) LETTURE CONCORRENTI ===============================================================
+//------------------------------------------------------------------------------------------
+static void concurrent(int n, int readers, bool locked) {
+    IndexableSkipList list;
+    std::mutex lock;   // usato solo se locked
+    for (int i = 0; i < n; i++) list.insert(2 * i);   // multipli di 4 stabili, 4k+2 variabili
+
+    std::atomic<bool> stop(false);
+    std::atomic<long long> reads(0), errors(0);
+    long long writes = 0;
+    size_t maxRetired = 0;
+    auto reader = [&](int id) {
+        std::mt19937 gen(100 + id);
+        long long r = 0, e = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            int key = 4 * (gen() % (n / 2)), k = 1, pos;
+            bool found;
+            if (locked) {
+                std::lock_guard<std::mutex> g(lock);
+                pos = list.search(key);
+                found = list.at(gen() % n, &k);
+            } else {
+                pos = list.search(key);
+                found = list.at(gen() % n, &k);
+            }
+            if (pos < 0 || (found && k % 2 != 0)) e++;
+            r += 2;
+        }
+        reads += r;
+        errors += e;
+    };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < readers; i++) threads.emplace_back(reader, i);
+
+    std::mt19937 gen(1);
+    auto start = std::chrono::steady_clock::now();
+    while (seconds(start) < 1.0) {
+        for (int i = 0; i < 100; i++) {
+            int key = 4 * (gen() % (n / 2)) + 2;
+            if (locked) {
+                std::lock_guard<std::mutex> g(lock);
+                if (list.remove(key)) list.insert(key);
+            } else if (list.remove(key)) {
+                list.insert(key);
+            }
+            writes += 2;
+        }
+        maxRetired = std::max(maxRetired, list.retiredCount());
+    }
+    stop = true;
+    for (auto& t : threads) t.join();
+    double s = seconds(start);
+    printf("%8d   %-12s %14.0f %18.0f %8lld %14zu\n", readers, locked ? "mutex" : "senza lock",
+           reads / s, writes / s, errors.load(), maxRetired);
+}
+
+int main(int argc, char* argv[]) {
+    long max = argc > 1 ? atol(argv[1]) : 1000000;
+    bool ok = verify();
+    printf("%s\n\n", ok ? "risultati uguali al vector ordinato" : "ERRORE");
+
+    printf("ns per operazione in una posizione casuale\n");
+    printf("            lista normale         UnrolledLinkedList    IndexableSkipList\n");
+    printf(" elementi   lettura  canc.+ins.   lettura  canc.+ins.   lettura  canc.+ins.\n");
+    std::mt19937 gen(42);
+    for (long n = 10000; n <= max; n *= 10) {
+        Times p = timePlain((int)n, gen), u = timeUnrolled((int)n, gen), s = timeSkip((int)n, gen);
+        printf("%9ld   %7.0f  %10.0f   %7.0f  %10.0f   %7.0f  %10.0f\n", n,
+               p.read, p.update, u.read, u.update, s.read, s.update);
+        fflush(stdout);
+    }
+
+    printf("\nLetture concorrenti su %ld elementi con uno scrittore (%u core)\n", max, std::thread::hardware_concurrency());
+    printf("%8s   %-12s %14s %18s %8s %14s\n", "lettori", "letture", "letture/s", "scritture/s", "errori",
+           "ritirati max");
+    for (int r = 1; r <= 4; r *= 2) {
+        concurrent((int)max, r, false);
+        concurrent((int)max, r, true);
+        fflush(stdout);
+    }
+    return ok ? 0 : 1;
+}
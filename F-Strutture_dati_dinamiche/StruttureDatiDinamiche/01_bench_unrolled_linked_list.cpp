@@ -0,0 +1,183 @@
+/** ****************************************************************************************
+* @file 01_bench_unrolled_linked_list.cpp
+* @brief Ricerca e scansione: lista concatenata normale contro UnrolledLinkedList da 1M a 100M elementi
+*
+* 1) Verifica: 200000 inserimenti e cancellazioni in posizioni casuali,
+*    confrontati con un std::vector (contenuto, search, at).
+* 2) Tempo di search (come cerca_ele in lista/lista01.cpp e search in
+*    01_c_linked_list.c) e di una scansione completa (somma degli elementi) per:
+*    - lista normale con i nodi in memoria nell'ordine della lista (il caso
+*      più favorevole: nodi creati uno dopo l'altro e mai spostati);
+*    - lista normale con i nodi sparsi (ordine casuale in memoria, come dopo
+*      molti inserimenti e cancellazioni);
+*    - UnrolledLinkedList riempita con insertAtEnd.
+*    Il tempo è in ns per elemento esaminato.
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 -march=native 01_bench_unrolled_linked_list.cpp -o bench_unrolled
+*   ./bench_unrolled [numero massimo di elementi, default 100000000]
+* (100M elementi richiedono circa 2.5 GB di RAM)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "01_cpp_unrolled_linked_list.h"
+
+// Nodo della lista normale, come in 01_c_linked_list.c
+struct Node {
+    int data;
+    Node* next;
+};
+
+static int search(const Node* head, int key) {
+    int position = 0;
+    for (const Node* current = head; current != nullptr; current = current->next) {
+        if (current->data == key) {
+            return position;
+        }
+        position++;
+    }
+    return -1;
+}
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verify() {
+    std::mt19937 gen(7);
+    UnrolledLinkedList list;
+    std::vector<int> ref;
+    for (int op = 0; op < 200000; op++) {
+        // Più inserimenti che cancellazioni, poi il contrario: la lista cresce e si svuota
+        bool insert = ref.empty() || (int)(gen() % 100) < (op < 120000 ? 65 : 30);
+        if (insert) {
+            int pos = gen() % (ref.size() + 1), value = gen() % 1000;
+            list.insertAtPosition(value, pos);
+            ref.insert(ref.begin() + pos, value);
+        } else {
+            int pos = gen() % ref.size();
+            list.deleteFromPosition(pos);
+            ref.erase(ref.begin() + pos);
+        }
+        if (op % 997 == 0) {
+            int key = gen() % 1000;
+            auto it = std::find(ref.begin(), ref.end(), key);
+            int expected = it == ref.end() ? -1 : (int)(it - ref.begin());
+            if (list.search(key) != expected || list.size() != (int)ref.size()) return false;
+            if (!ref.empty() && list.at(op % ref.size()) != ref[op % ref.size()]) return false;
+        }
+    }
+    std::vector<int> content;
+    list.forEach([&](int x) { content.push_back(x); });
+    printf("Verifica: %zu elementi in %d blocchi, ", ref.size(), list.blocks());
+    return content == ref;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+struct Result {
+    double search;   // ns per elemento esaminato
+    double scan;     // ns per elemento
+};
+
+// ns per elemento esaminato dalle ricerche; esce se una posizione è sbagliata
+template <typename Search>
+static double timeSearch(const std::vector<int>& keys, const std::vector<int>& positions, Search s) {
+    long long examined = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < keys.size(); i++) {
+        int p = s(keys[i]);
+        if (p != positions[i]) {
+            printf("ERRORE: search(%d) = %d invece di %d\n", keys[i], p, positions[i]);
+            exit(1);
+        }
+        examined += p + 1;
+    }
+    return seconds(start) / examined * 1e9;
+}
+
+static void run(int n, std::mt19937& gen) {
+    // Valori tutti diversi, così search trova la posizione attesa
+    std::vector<int> values(n);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), gen);
+    const int Q = 8;
+    std::vector<int> keys, positions;
+    for (int i = 0; i < Q; i++) {
+        int p = gen() % n;
+        positions.push_back(p);
+        keys.push_back(values[p]);
+    }
+
+    auto timeScan = [&](auto sum) {
+        auto start = std::chrono::steady_clock::now();
+        volatile long long total = sum();
+        (void)total;
+        return seconds(start) / n * 1e9;
+    };
+
+    Result plain[2];
+    for (int scattered = 0; scattered < 2; scattered++) {
+        // Nodi in un unico array; l'ordine dei collegamenti decide la disposizione in memoria
+        std::vector<Node> nodes(n);
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        if (scattered) std::shuffle(order.begin(), order.end(), gen);
+        for (int i = 0; i < n; i++) {
+            Node& node = nodes[order[i]];
+            node.data = values[i];
+            node.next = i + 1 < n ? &nodes[order[i + 1]] : nullptr;
+        }
+        const Node* head = &nodes[order[0]];
+        std::vector<int>().swap(order);
+        plain[scattered].search = timeSearch(keys, positions, [&](int k) { return search(head, k); });
+        plain[scattered].scan = timeScan([&] {
+            long long s = 0;
+            for (const Node* c = head; c != nullptr; c = c->next) s += c->data;
+            return s;
+        });
+    }
+
+    UnrolledLinkedList list;
+    for (int i = 0; i < n; i++) list.insertAtEnd(values[i]);
+    Result unrolled;
+    unrolled.search = timeSearch(keys, positions, [&](int k) { return list.search(k); });
+    unrolled.scan = timeScan([&] {
+        long long s = 0;
+        list.forEach([&](int x) { s += x; });
+        return s;
+    });
+
+    printf("%11d   %6.2f %6.2f   %6.2f %6.2f   %6.2f %6.2f\n", n,
+           plain[0].search, plain[0].scan, plain[1].search, plain[1].scan, unrolled.search, unrolled.scan);
+}
+
+int main(int argc, char* argv[]) {
+    long max = argc > 1 ? atol(argv[1]) : 100000000;
+    bool ok = verify();
+    printf("%s\n\n", ok ? "contenuto uguale al vector" : "ERRORE");
+
+    printf("ns per elemento (search = media su 8 ricerche di chiavi presenti)\n");
+    printf("                 lista normale      lista normale      UnrolledLinkedList\n");
+    printf("                 nodi in ordine     nodi sparsi        (%d elementi per blocco)\n", UnrolledLinkedList::CAPACITY);
+    printf("  elementi   search   scan   search   scan   search   scan\n");
+    std::mt19937 gen(42);
+    for (long n = 1000000; n <= max; n *= 10) {
+        run((int)n, gen);
+        fflush(stdout);
+    }
+    return ok ? 0 : 1;
+}
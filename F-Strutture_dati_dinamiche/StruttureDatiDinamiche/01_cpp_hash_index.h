@@ -0,0 +1,200 @@
+/** ****************************************************************************************
+* @file 01_cpp_hash_index.h
+* @brief Tabella hash (indirizzamento aperto, stile SwissTable) per l'indice di una lista
+*
+* Per sapere se un valore è nella lista search deve percorrerla tutta: O(n).
+* HashIndex<Key, Value> associa ad ogni chiave (un int o un puntatore) un
+* valore, con ricerca, inserimento e cancellazione in O(1) medio; ogni
+* chiave compare al massimo una volta. LinkedList in 01_cpp_linked_list.h
+* ne usa due, tenute aggiornate ad ogni modifica se si chiama enableIndex():
+* una dai valori ai nodi che li contengono e una da ogni nodo al precedente.
+*
+* Organizzazione (come la SwissTable di Abseil):
+*  - le caselle sono divise in gruppi di 16; per ogni casella c'è un byte di
+*    controllo: VUOTA, CANCELLATA oppure 7 bit dell'hash del valore (tag);
+*  - una ricerca confronta i 16 byte di controllo di un gruppo con il tag in
+*    una sola istruzione SSE2 e guarda solo le caselle che corrispondono; se il
+*    gruppo ha una casella vuota la ricerca finisce, altrimenti passa al gruppo
+*    successivo della sequenza (sondaggio triangolare: 1, 2, 3... gruppi dopo);
+*  - la tabella raddoppia quando le caselle usate superano i 7/8.
+* Un puntatore a una casella (Entry*) resta valido fino al prossimo insert.
+*
+* Uso: #include "01_cpp_hash_index.h" (vedi 01_cpp_linked_list.h)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef HASH_INDEX_H
+#define HASH_INDEX_H
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+template <typename Key, typename Value>
+class HashIndex {
+public:
+    struct Entry {
+        Key key;
+        Value value;
+    };
+
+private:
+    static const int GROUP = 16;
+    static const int8_t EMPTY = -128;     // 0x80
+    static const int8_t DELETED = -2;     // 0xFE; i tag vanno da 0 a 127
+
+    int8_t* ctrl;
+    Entry* slots;
+    size_t groups;      // potenza di 2
+    size_t size_;
+    size_t used;        // caselle piene + cancellate
+
+    static uint64_t bits(int key) { return (uint32_t)key; }
+    static uint64_t bits(const void* key) { return (uintptr_t)key; }
+
+    // Gli shift portano nei 7 bit bassi (il tag) anche i bit alti del prodotto:
+    // i puntatori hanno i bit bassi sempre a zero
+    static uint64_t hash(Key key) {
+        uint64_t h = bits(key) * 0x9E3779B97F4A7C15ULL;
+        return h ^ (h >> 29);
+    }
+
+    // Caselle del gruppo g il cui byte di controllo vale c (un bit per casella)
+    unsigned match(size_t g, int8_t c) const {
+        const int8_t* p = ctrl + g * GROUP;
+#if defined(__SSE2__)
+        __m128i v = _mm_loadu_si128((const __m128i*)p);
+        return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+#else
+        unsigned mask = 0;
+        for (int i = 0; i < GROUP; i++) mask |= (unsigned)(p[i] == c) << i;
+        return mask;
+#endif
+    }
+
+    // Caselle libere (vuote o cancellate): hanno il bit alto a 1
+    unsigned matchFree(size_t g) const {
+        const int8_t* p = ctrl + g * GROUP;
+#if defined(__SSE2__)
+        return (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)p));
+#else
+        unsigned mask = 0;
+        for (int i = 0; i < GROUP; i++) mask |= (unsigned)(p[i] < 0) << i;
+        return mask;
+#endif
+    }
+
+    // La casella con la chiave key, nullptr se non c'è
+    Entry* lookup(Key key) const {
+        if (size_ == 0) return nullptr;
+        uint64_t h = hash(key);
+        int8_t tag = (int8_t)(h & 0x7F);
+        size_t g = (h >> 7) & (groups - 1);
+        for (size_t step = 1;; step++) {
+            for (unsigned m = match(g, tag); m != 0; m &= m - 1) {
+                Entry* e = &slots[g * GROUP + __builtin_ctz(m)];
+                if (e->key == key) return e;
+            }
+            if (match(g, EMPTY) != 0) return nullptr;
+            g = (g + step) & (groups - 1);
+        }
+    }
+
+    void allocate(size_t n) {
+        groups = n;
+        ctrl = new int8_t[groups * GROUP];   // letti con _mm_loadu_si128: non serve allinearli
+        memset(ctrl, EMPTY, groups * GROUP);
+        slots = (Entry*)::operator new(groups * GROUP * sizeof(Entry));
+        used = size_;
+    }
+
+    void release() {
+        delete[] ctrl;
+        ::operator delete(slots);
+    }
+
+    // Nuova tabella (più grande se serve) senza le caselle cancellate
+    void rehash() {
+        int8_t* oldCtrl = ctrl;
+        Entry* oldSlots = slots;
+        size_t oldGroups = groups;
+        size_t n = groups;
+        while (size_ + 1 > n * GROUP / 2) n *= 2;   // dopo il rehash al massimo metà piena
+        allocate(n);
+        size_ = 0;
+        used = 0;
+        for (size_t i = 0; i < oldGroups * GROUP; i++) {
+            if (oldCtrl[i] >= 0) place(oldSlots[i]);
+        }
+        delete[] oldCtrl;
+        ::operator delete(oldSlots);
+    }
+
+    Entry* place(const Entry& entry) {
+        uint64_t h = hash(entry.key);
+        size_t g = (h >> 7) & (groups - 1);
+        unsigned m;
+        for (size_t step = 1; (m = matchFree(g)) == 0; step++) {
+            g = (g + step) & (groups - 1);
+        }
+        size_t i = g * GROUP + __builtin_ctz(m);
+        if (ctrl[i] == EMPTY) used++;
+        ctrl[i] = (int8_t)(h & 0x7F);
+        slots[i] = entry;
+        size_++;
+        return &slots[i];
+    }
+
+public:
+    // Constructor
+    HashIndex() : size_(0) {
+        allocate(1);
+    }
+
+    HashIndex(const HashIndex&) = delete;
+    HashIndex& operator=(const HashIndex&) = delete;
+
+    ~HashIndex() {
+        release();
+    }
+
+    size_t size() const { return size_; }
+
+    void clear() {
+        release();
+        size_ = 0;
+        allocate(1);
+    }
+
+    // Aggiunge la chiave key, che non deve essere già presente; restituisce la sua casella
+    Entry* insert(Key key, const Value& value) {
+        if (used + 1 > groups * GROUP / 8 * 7) rehash();
+        return place(Entry{key, value});
+    }
+
+    Entry* find(Key key) const {
+        return lookup(key);
+    }
+
+    void erase(Entry* e) {
+        size_t i = e - slots;
+        size_t g = i / GROUP;
+        // Se il gruppo ha già una casella vuota nessuna ricerca va oltre questo
+        // gruppo passando da qui: la casella può tornare vuota
+        if (match(g, EMPTY) != 0) {
+            ctrl[i] = EMPTY;
+            used--;
+        } else {
+            ctrl[i] = DELETED;
+        }
+        size_--;
+    }
+};
+
+#endif
@@ -1,180 +1,10 @@
 #include <iostream>
-#include <memory>
-
-class Node {
-public:
-    int data;
-    std::shared_ptr<Node> next;
-    
-    // Constructor
-    Node(int val) : data(val), next(nullptr) {}
-};
-
-class LinkedList {
-private:
-    std::shared_ptr<Node> head;
-    
-public:
-    // Constructor
-    LinkedList() : head(nullptr) {}
-    
-    // Insert at the beginning
-    void insertAtBeginning(int data) {
-        std::shared_ptr<Node> newNode = std::make_shared<Node>(data);
-        newNode->next = head;
-        head = newNode;
-    }
-    
-    // Insert at the end
-    void insertAtEnd(int data) {
-        std::shared_ptr<Node> newNode = std::make_shared<Node>(data);
-        
-        // If the list is empty
-        if (head == nullptr) {
-            head = newNode;
-            return;
-        }
-        
-        // Traverse to the end of the list
-        std::shared_ptr<Node> current = head;
-        while (current->next != nullptr) {
-            current = current->next;
-        }
-        
-        // Link the new node at the end
-        current->next = newNode;
-    }
-    
-    // Insert at a specific position
-    void insertAtPosition(int data, int position) {
-        // If position is 0, insert at the beginning
-        if (position == 0) {
-            insertAtBeginning(data);
-            return;
-        }
-        
-        std::shared_ptr<Node> newNode = std::make_shared<Node>(data);
-        std::shared_ptr<Node> current = head;
-        int i = 0;
-        
-        // Traverse to the position - 1
-        while (current != nullptr && i < position - 1) {
-            current = current->next;
-            i++;
-        }
-        
-        // If position is beyond the end of the list
-        if (current == nullptr) {
-            std::cout << "Position out of range!" << std::endl;
-            return;
-        }
-        
-        // Insert the new node
-        newNode->next = current->next;
-        current->next = newNode;
-    }
-    
-    // Delete from the beginning
-    void deleteFromBeginning() {
-        if (head == nullptr) {
-            std::cout << "List is empty!" << std::endl;
-            return;
-        }
-        
-        head = head->next;
-    }
-    
-    // Delete from the end
-    void deleteFromEnd() {
-        if (head == nullptr) {
-            std::cout << "List is empty!" << std::endl;
-            return;
-        }
-        
-        // If there is only one node
-        if (head->next == nullptr) {
-            head = nullptr;
-            return;
-        }
-        
-        // Traverse to the second last node
-        std::shared_ptr<Node> current = head;
-        while (current->next->next != nullptr) {
-            current = current->next;
-        }
-        
-        // Delete the last node
-        current->next = nullptr;
-    }
-    
-    // Delete from a specific position
-    void deleteFromPosition(int position) {
-        if (head == nullptr) {
-            std::cout << "List is empty!" << std::endl;
-            return;
-        }
-        
-        // If position is 0, delete from the beginning
-        if (position == 0) {
-            deleteFromBeginning();
-            return;
-        }
-        
-        std::shared_ptr<Node> current = head;
-        int i = 0;
-        
-        // Traverse to the position - 1
-        while (current != nullptr && i < position - 1) {
-            current = current->next;
-            i++;
-        }
-        
-        // If position is beyond the end of the list or the next node is NULL
-        if (current == nullptr || current->next == nullptr) {
-            std::cout << "Position out of range!" << std::endl;
-            return;
-        }
-        
-        // Delete the node at position
-        current->next = current->next->next;
-    }
-    
-    // Search for an element
-    int search(int key) {
-        std::shared_ptr<Node> current = head;
-        int position = 0;
-        
-        while (current != nullptr) {
-            if (current->data == key) {
-                return position;  // Return the position if found
-            }
-            current = current->next;
-            position++;
-        }
-        
-        return -1;  // Return -1 if not found
-    }
-    
-    // Display the list
-    void display() {
-        if (head == nullptr) {
-            std::cout << "List is empty!" << std::endl;
-            return;
-        }
-        
-        std::shared_ptr<Node> current = head;
-        std::cout << "Linked List: ";
-        while (current != nullptr) {
-            std::cout << current->data << " -> ";
-            current = current->next;
-        }
-        std::cout << "NULL" << std::endl;
-    }
-};
+#include "01_cpp_linked_list.h" // Node, LinkedList
 
 // Main function to demonstrate the linked list operations
 int main() {
     LinkedList list;
+    list.enableIndex();  // ricerca ed eliminazione per valore in O(1)
     int choice, data, position, result;
     
     // Definizione dei codici colore ANSI
@@ -195,6 +25,7 @@ int main() {
         std::cout << "\n" << ROSSO << "6. Elimina da una posizione specifica" << RESET;
         std::cout << "\n" << GIALLO << "7. Cerca un elemento" << RESET;
         std::cout << "\n" << GIALLO << "8. Visualizza la lista" << RESET;
+        std::cout << "\n" << ROSSO << "9. Elimina un elemento per valore (se ripetuto, uno qualsiasi)" << RESET;
         std::cout << "\n" << VERDE << "0. Esci" << RESET;
         
         std::cout << "\n\n" << VERDE << "Inserisci la tua scelta: " << RESET;
@@ -250,6 +81,14 @@ int main() {
                 list.display();
                 break;
                 
+            case 9:
+                std::cout << ROSSO << "Inserisci l'elemento da eliminare: " << RESET;
+                std::cin >> data;
+                if (!list.deleteValue(data)) {
+                    std::cout << ROSSO << "Elemento non trovato!" << RESET << std::endl;
+                }
+                break;
+                
             case 0:
                 std::cout << VERDE << "Uscita in corso..." << RESET << std::endl;
                 break;
@@ -0,0 +1,364 @@
+/** ****************************************************************************************
+* @file 01_cpp_linked_list.h
+* @brief Lista concatenata semplice in C++ (LinkedList), con indice hash facoltativo
+*
+* Le operazioni sono quelle del menu di 01_cpp_linked_list.cpp. Dopo
+* enableIndex() la lista mantiene anche due HashIndex (01_cpp_hash_index.h),
+* aggiornati ad ogni inserimento e cancellazione:
+*  - values: per ogni valore distinto, uno dei nodi che lo contengono; i nodi
+*    con lo stesso valore sono collegati fra loro (sameNext, samePrev);
+*  - nodes: per ogni nodo il nodo precedente nella lista (per staccarlo da una
+*    lista semplice senza cercarlo) e i collegamenti con gli altri nodi con lo
+*    stesso valore.
+* contains(valore) e deleteValue(valore) passano da O(n) a O(1), anche con
+* molti valori ripetuti, e search risponde subito se il valore non c'è.
+* search resta O(n) quando il valore c'è, perché deve contarne la posizione.
+* Con valori ripetuti deleteValue senza indice toglie il primo nodo della
+* lista con quel valore, con l'indice uno qualunque di essi.
+*
+* Uso: #include "01_cpp_linked_list.h" (vedi 01_cpp_linked_list.cpp e 01_bench_hash_index.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef LINKED_LIST_H
+#define LINKED_LIST_H
+
+#include <iostream>
+#include <memory>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
+#include "01_cpp_hash_index.h"
+
+class Node {
+public:
+    int data;
+    std::shared_ptr<Node> next;
+    
+    // Constructor
+    Node(int val) : data(val), next(nullptr) {}
+};
+
+class LinkedList {
+private:
+    struct NodeLinks {
+        Node* prev;       // nodo precedente nella lista (nullptr: testa)
+        Node* sameNext;   // altri nodi con lo stesso valore (nullptr: nessuno)
+        Node* samePrev;
+    };
+    
+    struct Index {
+        HashIndex<int, Node*> values;              // valore -> primo nodo della sua catena
+        HashIndex<const Node*, NodeLinks> nodes;
+    };
+    
+    std::shared_ptr<Node> head;
+    std::unique_ptr<Index> index;   // solo dopo enableIndex()
+    
+    NodeLinks& links(const Node* n) const {
+        return index->nodes.find(n)->value;
+    }
+    
+    // Aggiunge n, che segue prev, all'indice (in testa alla catena del suo valore)
+    void indexAdd(Node* prev, Node* n) {
+        NodeLinks l = {prev, nullptr, nullptr};
+        HashIndex<int, Node*>::Entry* v = index->values.find(n->data);
+        if (v == nullptr) {
+            index->values.insert(n->data, n);
+        } else {
+            l.sameNext = v->value;
+            links(v->value).samePrev = n;
+            v->value = n;
+        }
+        index->nodes.insert(n, l);
+    }
+    
+    // Aggiorna l'indice dopo aver collegato n dopo prev (nullptr: n è la testa)
+    void indexLinked(Node* prev, Node* n) {
+        if (index == nullptr) return;
+        indexAdd(prev, n);
+        if (n->next != nullptr) {
+            links(n->next.get()).prev = n;
+        }
+    }
+    
+    // Aggiorna l'indice prima di staccare n, che segue prev (nullptr: n è la testa)
+    void indexUnlinking(Node* prev, Node* n) {
+        if (index == nullptr) return;
+        HashIndex<const Node*, NodeLinks>::Entry* e = index->nodes.find(n);
+        NodeLinks l = e->value;
+        index->nodes.erase(e);
+        if (l.sameNext != nullptr) {
+            links(l.sameNext).samePrev = l.samePrev;
+        }
+        if (l.samePrev != nullptr) {
+            links(l.samePrev).sameNext = l.sameNext;
+        } else {
+            // n era il primo della catena del suo valore
+            HashIndex<int, Node*>::Entry* v = index->values.find(n->data);
+            if (l.sameNext != nullptr) {
+                v->value = l.sameNext;
+            } else {
+                index->values.erase(v);
+            }
+        }
+        if (n->next != nullptr) {
+            links(n->next.get()).prev = prev;
+        }
+    }
+    
+    // Stacca n, che segue prev (nullptr: n è la testa)
+    void unlink(Node* prev, Node* n) {
+        indexUnlinking(prev, n);
+        if (prev == nullptr) {
+            head = n->next;
+        } else {
+            prev->next = n->next;
+        }
+    }
+    
+public:
+    // Constructor
+    LinkedList() : head(nullptr) {}
+    
+    // Destructor: libera i nodi uno alla volta; lasciarlo fare agli shared_ptr
+    // distruggerebbe ogni nodo dentro la distruzione del precedente (ricorsione
+    // profonda quanto la lista: stack overflow con milioni di nodi)
+    ~LinkedList() {
+        while (head != nullptr) {
+            head = std::move(head->next);
+        }
+    }
+    
+    // Attiva l'indice hash (01_cpp_hash_index.h): contains e deleteValue
+    // diventano O(1), al costo di circa 80-100 byte in più per nodo
+    void enableIndex() {
+        index.reset(new Index());
+        Node* prev = nullptr;
+        for (Node* n = head.get(); n != nullptr; prev = n, n = n->next.get()) {
+            indexAdd(prev, n);
+        }
+    }
+    
+    bool indexed() const {
+        return index != nullptr;
+    }
+    
+    // Insert at the beginning
+    void insertAtBeginning(int data) {
+        std::shared_ptr<Node> newNode = std::make_shared<Node>(data);
+        newNode->next = head;
+        head = newNode;
+        indexLinked(nullptr, newNode.get());
+    }
+    
+    // Insert at the end
+    void insertAtEnd(int data) {
+        std::shared_ptr<Node> newNode = std::make_shared<Node>(data);
+        
+        // If the list is empty
+        if (head == nullptr) {
+            head = newNode;
+            indexLinked(nullptr, newNode.get());
+            return;
+        }
+        
+        // Traverse to the end of the list
+        std::shared_ptr<Node> current = head;
+        while (current->next != nullptr) {
+            current = current->next;
+        }
+        
+        // Link the new node at the end
+        current->next = newNode;
+        indexLinked(current.get(), newNode.get());
+    }
+    
+    // Insert at a specific position
+    void insertAtPosition(int data, int position) {
+        // If position is 0, insert at the beginning
+        if (position == 0) {
+            insertAtBeginning(data);
+            return;
+        }
+        
+        std::shared_ptr<Node> newNode = std::make_shared<Node>(data);
+        std::shared_ptr<Node> current = head;
+        int i = 0;
+        
+        // Traverse to the position - 1
+        while (current != nullptr && i < position - 1) {
+            current = current->next;
+            i++;
+        }
+        
+        // If position is beyond the end of the list
+        if (current == nullptr) {
+            std::cout << "Position out of range!" << std::endl;
+            return;
+        }
+        
+        // Insert the new node
+        newNode->next = current->next;
+        current->next = newNode;
+        indexLinked(current.get(), newNode.get());
+    }
+    
+    // Delete from the beginning
+    void deleteFromBeginning() {
+        if (head == nullptr) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        
+        unlink(nullptr, head.get());
+    }
+    
+    // Delete from the end
+    void deleteFromEnd() {
+        if (head == nullptr) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        
+        // If there is only one node
+        if (head->next == nullptr) {
+            unlink(nullptr, head.get());
+            return;
+        }
+        
+        // Traverse to the second last node
+        std::shared_ptr<Node> current = head;
+        while (current->next->next != nullptr) {
+            current = current->next;
+        }
+        
+        // Delete the last node
+        unlink(current.get(), current->next.get());
+    }
+    
+    // Delete from a specific position
+    void deleteFromPosition(int position) {
+        if (head == nullptr) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        
+        // If position is 0, delete from the beginning
+        if (position == 0) {
+            deleteFromBeginning();
+            return;
+        }
+        
+        std::shared_ptr<Node> current = head;
+        int i = 0;
+        
+        // Traverse to the position - 1
+        while (current != nullptr && i < position - 1) {
+            current = current->next;
+            i++;
+        }
+        
+        // If position is beyond the end of the list or the next node is NULL
+        if (current == nullptr || current->next == nullptr) {
+            std::cout << "Position out of range!" << std::endl;
+            return;
+        }
+        
+        // Delete the node at position
+        unlink(current.get(), current->next.get());
+    }
+    
+    // Delete the first node with the given value (con l'indice: uno dei nodi con quel valore)
+    bool deleteValue(int key) {
+        if (index != nullptr) {
+            HashIndex<int, Node*>::Entry* v = index->values.find(key);
+            if (v == nullptr) return false;
+            Node* n = v->value;
+            unlink(links(n).prev, n);
+            return true;
+        }
+        Node* prev = nullptr;
+        for (Node* n = head.get(); n != nullptr; prev = n, n = n->next.get()) {
+            if (n->data == key) {
+                unlink(prev, n);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    // Membership check: O(1) con l'indice, altrimenti come search
+    bool contains(int key) const {
+        if (index != nullptr) return index->values.find(key) != nullptr;
+        for (const Node* n = head.get(); n != nullptr; n = n->next.get()) {
+            if (n->data == key) return true;
+        }
+        return false;
+    }
+    
+    // Search for an element
+    int search(int key) {
+        if (index != nullptr && index->values.find(key) == nullptr) {
+            return -1;  // l'indice dice subito se l'elemento non c'è
+        }
+        std::shared_ptr<Node> current = head;
+        int position = 0;
+        
+        while (current != nullptr) {
+            if (current->data == key) {
+                return position;  // Return the position if found
+            }
+            current = current->next;
+            position++;
+        }
+        
+        return -1;  // Return -1 if not found
+    }
+    
+    // Display the list
+    void display() {
+        if (head == nullptr) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        
+        // Scorre i nodi con un puntatore semplice: copiare lo shared_ptr
+        // ad ogni passo aggiornerebbe il contatore dei riferimenti
+        const Node* current = head.get();
+        uscitaTesto("Linked List: ");
+        while (current != nullptr) {
+            uscitaIntero(current->data);
+            uscitaTesto(" -> ");
+            current = current->next.get();
+        }
+        uscitaTesto("NULL\n");
+        uscitaSvuota();  // una sola scrittura per tutta la lista
+    }
+    
+    // Controlla che l'indice contenga esattamente i nodi della lista con i loro
+    // precedenti e che ogni catena colleghi tutti e soli i nodi del suo valore
+    bool indexConsistent() const {
+        if (index == nullptr) return true;
+        size_t n = 0, chained = 0, chains = 0;
+        Node* prev = nullptr;
+        for (Node* x = head.get(); x != nullptr; prev = x, x = x->next.get(), n++) {
+            HashIndex<const Node*, NodeLinks>::Entry* e = index->nodes.find(x);
+            HashIndex<int, Node*>::Entry* v = index->values.find(x->data);
+            if (e == nullptr || e->value.prev != prev || v == nullptr) return false;
+            if (v->value != x) continue;
+            // x è il primo della catena del suo valore: la si percorre una volta sola
+            chains++;
+            Node* samePrev = nullptr;
+            for (Node* y = x; y != nullptr; samePrev = y, y = links(y).sameNext, chained++) {
+                if (index->nodes.find(y) == nullptr || y->data != x->data || links(y).samePrev != samePrev ||
+                    chained > index->nodes.size()) {
+                    return false;
+                }
+            }
+        }
+        return n == index->nodes.size() && chained == n && chains == index->values.size();
+    }
+};
+
+#endif
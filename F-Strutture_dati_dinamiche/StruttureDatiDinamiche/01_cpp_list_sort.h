@@ -0,0 +1,179 @@
+/** ****************************************************************************************
+* @file 01_cpp_list_sort.h
+* @brief Ordinamento delle liste concatenate: merge sort, radix sort e merge sort parallelo
+*
+* Le funzioni riordinano i nodi cambiando solo i puntatori next (nessun nodo
+* viene copiato o allocato) e restituiscono la nuova testa. Vanno bene per
+* qualunque nodo con un campo next, come quelli delle liste di questa cartella
+* e di lista/, pila/, coda/: il valore da confrontare si indica con una
+* funzione, ad esempio
+*   head = listMergeSort(head, [](const Node* n) { return n->data; });
+*   pTesta = listRadixSort(pTesta, [](const nodo* n) { return n->info; });
+*
+*  - listMergeSort: merge sort "dal basso" (bottom-up) senza ricorsione e con
+*    memoria aggiuntiva costante (64 puntatori). Stabile, O(n log n).
+*  - listRadixSort: radix sort LSD sui 32 bit della chiave, 16 bit per passata
+*    (65536 "secchi"): ogni passata stacca i nodi e li riaggancia in coda al
+*    secchio della loro cifra. Stabile, O(n) con al massimo 2 passate (ognuna
+*    percorre tutta la lista, quindi meno passate = meno accessi sparsi); le
+*    passate in cui tutte le chiavi hanno la stessa cifra vengono saltate.
+*  - listParallelSort: divide la lista in parti, le ordina con listMergeSort
+*    su più thread e poi le fonde a coppie, sempre in parallelo.
+*
+* Uso: #include "01_cpp_list_sort.h" (vedi 01_bench_list_sort.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef LIST_SORT_H
+#define LIST_SORT_H
+
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+// Fonde due liste ordinate; a parità di chiave vengono prima i nodi di a (stabile)
+template <typename Node, typename Key>
+Node* mergeSortedLists(Node* a, Node* b, Key key) {
+    Node* head;
+    Node** tail = &head;
+    while (a != nullptr && b != nullptr) {
+        if (key(b) < key(a)) {
+            *tail = b;
+            tail = &b->next;
+            b = b->next;
+        } else {
+            *tail = a;
+            tail = &a->next;
+            a = a->next;
+        }
+    }
+    *tail = a != nullptr ? a : b;
+    return head;
+}
+
+/**
+ * Merge sort bottom-up. bins[i] contiene una lista ordinata di 2^i nodi (o è
+ * vuoto): ogni nodo staccato dalla lista viene fuso con bins[0], il risultato
+ * con bins[1] e così via, come quando si somma 1 ad un numero binario.
+ */
+template <typename Node, typename Key>
+Node* listMergeSort(Node* head, Key key) {
+    const int BINS = 64;
+    Node* bins[BINS] = {};
+    int used = 0;
+    while (head != nullptr) {
+        Node* run = head;
+        head = head->next;
+        run->next = nullptr;
+        int i = 0;
+        for (; i < used && bins[i] != nullptr; i++) {
+            run = mergeSortedLists(bins[i], run, key);   // bins[i] ha i nodi precedenti
+            bins[i] = nullptr;
+        }
+        if (i == used && used < BINS) used++;
+        if (i == BINS) i = BINS - 1;
+        bins[i] = run;
+    }
+    Node* result = nullptr;
+    for (int i = 0; i < used; i++) {
+        if (bins[i] != nullptr) {
+            result = result == nullptr ? bins[i] : mergeSortedLists(bins[i], result, key);
+        }
+    }
+    return result;
+}
+
+template <typename Node, typename Key>
+Node* listRadixSort(Node* head, Key key) {
+    const int BITS = 16;
+    const int BUCKETS = 1 << BITS;
+    const int PASSES = (32 + BITS - 1) / BITS;
+    // Chiave senza segno con lo stesso ordine: si inverte il bit del segno
+    auto digits = [&](const Node* n) { return (uint32_t)key(n) ^ 0x80000000u; };
+    if (head == nullptr) return head;
+
+    // Una prima passata conta le cifre di tutte le posizioni
+    std::vector<long> count(PASSES * BUCKETS, 0);
+    long n = 0;
+    for (const Node* x = head; x != nullptr; x = x->next) {
+        uint32_t d = digits(x);
+        for (int p = 0; p < PASSES; p++) {
+            count[p * BUCKETS + ((d >> (p * BITS)) & (BUCKETS - 1))]++;
+        }
+        n++;
+    }
+
+    std::vector<Node*> heads(BUCKETS), tails(BUCKETS);
+    for (int p = 0; p < PASSES; p++) {
+        int shift = p * BITS;
+        if (count[p * BUCKETS + ((digits(head) >> shift) & (BUCKETS - 1))] == n) {
+            continue;   // tutte le chiavi hanno la stessa cifra: la passata non cambierebbe nulla
+        }
+        for (int b = 0; b < BUCKETS; b++) heads[b] = nullptr;
+        for (Node* x = head; x != nullptr; x = x->next) {
+            int b = (digits(x) >> shift) & (BUCKETS - 1);
+            if (heads[b] == nullptr) heads[b] = x;
+            else tails[b]->next = x;
+            tails[b] = x;
+        }
+        // Si riagganciano i secchi in ordine
+        Node** tail = &head;
+        for (int b = 0; b < BUCKETS; b++) {
+            if (heads[b] != nullptr) {
+                *tail = heads[b];
+                tail = &tails[b]->next;
+            }
+        }
+        *tail = nullptr;
+    }
+    return head;
+}
+
+/**
+ * Merge sort parallelo: la lista viene tagliata in threads parti di uguale
+ * lunghezza, ordinate contemporaneamente; poi le parti vengono fuse a coppie
+ * (metà dei thread ad ogni livello) fino ad ottenerne una sola.
+ */
+template <typename Node, typename Key>
+Node* listParallelSort(Node* head, Key key, int threads = (int)std::thread::hardware_concurrency()) {
+    long n = 0;
+    for (Node* x = head; x != nullptr; x = x->next) n++;
+    if (threads < 2 || n < 2 * threads) {
+        return listMergeSort(head, key);
+    }
+
+    std::vector<Node*> parts;
+    for (int t = 0; t < threads; t++) {
+        long length = n / threads + (t < n % threads ? 1 : 0);
+        Node* start = head;
+        for (long i = 1; i < length; i++) head = head->next;
+        Node* last = head;
+        head = head->next;
+        last->next = nullptr;
+        parts.push_back(start);
+    }
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&parts, &key, t] { parts[t] = listMergeSort(parts[t], key); });
+    }
+    for (std::thread& th : pool) th.join();
+
+    while (parts.size() > 1) {
+        std::vector<Node*> merged((parts.size() + 1) / 2);
+        pool.clear();
+        for (size_t i = 0; i + 1 < parts.size(); i += 2) {
+            pool.emplace_back([&parts, &merged, &key, i] {
+                merged[i / 2] = mergeSortedLists(parts[i], parts[i + 1], key);
+            });
+        }
+        if (parts.size() % 2 == 1) merged.back() = parts.back();
+        for (std::thread& th : pool) th.join();
+        parts.swap(merged);
+    }
+    return parts[0];
+}
+
+#endif
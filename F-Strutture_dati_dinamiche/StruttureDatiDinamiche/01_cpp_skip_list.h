@@ -0,0 +1,380 @@
+/** ****************************************************************************************
+* @file 01_cpp_skip_list.h
+* @brief Skip list indicizzabile: ricerca per chiave e accesso per posizione in O(log n)
+*
+* Una skip list è una lista ordinata con più livelli di collegamenti: il livello
+* 0 collega tutti i nodi, ogni livello superiore ne salta circa 3 su 4 (ogni
+* nodo ha altezza casuale). La ricerca parte dal livello più alto e scende,
+* come in una ricerca binaria: O(log n) passi invece degli O(n) di search,
+* insertAtPosition e deleteFromPosition in 01_cpp_linked_list.cpp o di
+* trova_pos_ele in lista/lista01.cpp.
+*
+* Ogni collegamento ricorda anche la sua "larghezza", cioè quanti elementi
+* salta: sommando le larghezze si conosce la posizione raggiunta, quindi anche
+* at(posizione) e removeAt(posizione) sono O(log n). Le posizioni partono da 0
+* e sono quelle nell'ordine crescente delle chiavi (chiavi ripetute ammesse).
+*
+* Letture concorrenti senza mutex: search, contains, at e size si possono
+* chiamare da più thread mentre un altro modifica la lista.
+*  - Le modifiche (insert, remove, removeAt) sono serializzate da un mutex.
+*  - Un contatore di versione (seqlock) è dispari durante una modifica: un
+*    lettore legge la versione, percorre la lista e la rilegge; se è cambiata
+*    (o era dispari) ricomincia. I lettori non bloccano mai chi scrive, ma
+*    aspettano (con yield) mentre una modifica è in corso e ripetono la lettura
+*    se una modifica l'ha attraversata: è un seqlock, non una lettura lock-free.
+*  - Un nodo tolto dalla lista non viene liberato subito (un lettore potrebbe
+*    starci ancora passando). Si usano due epoche: ogni lettore si registra
+*    nel contatore dell'epoca in cui inizia. Alla fine di una modifica, se non
+*    c'è più nessun lettore dell'epoca precedente, lo scrittore libera i nodi
+*    tolti prima dell'inizio dell'epoca corrente e passa all'epoca successiva.
+*    Non serve mai un istante senza lettori: basta che ogni lettura finisca,
+*    e un nodo viene liberato al più due cambi di epoca dopo essere stato tolto.
+*
+* Uso: #include "01_cpp_skip_list.h" (vedi 01_bench_skip_list.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
+
+class IndexableSkipList {
+public:
+    static const int MAX_LEVEL = 24;   // 4^24 elementi: più che sufficiente
+
+private:
+    struct Node;
+
+    struct Link {
+        std::atomic<Node*> next;
+        std::atomic<int> width;        // elementi saltati dal collegamento (posizione di next - posizione del nodo)
+    };
+
+    struct Node {
+        int key;
+        int height;
+        Link links[1];                 // in realtà height collegamenti (allocati in newNode)
+    };
+
+    Node* head;                        // sentinella con MAX_LEVEL collegamenti, posizione -1
+    std::atomic<int> level;            // livelli in uso
+    std::atomic<int> size_;
+    std::atomic<unsigned> version;     // dispari durante una modifica
+    std::atomic<unsigned> epoch;
+    std::atomic<int> readers[2];       // lettori attivi registrati nelle epoche pari e dispari
+    std::mutex writer;
+    std::vector<Node*> retired;        // nodi tolti nell'epoca corrente
+    std::vector<Node*> retiredOld;     // nodi tolti nell'epoca precedente
+    uint64_t seed;
+
+    static Node* newNode(int key, int height) {
+        void* memory = ::operator new(sizeof(Node) + (height - 1) * sizeof(Link));
+        Node* n = (Node*)memory;
+        n->key = key;
+        n->height = height;
+        for (int i = 0; i < height; i++) {
+            new (&n->links[i]) Link();
+            n->links[i].next.store(nullptr, std::memory_order_relaxed);
+            n->links[i].width.store(0, std::memory_order_relaxed);
+        }
+        return n;
+    }
+
+    static void freeNode(Node* n) {
+        ::operator delete(n);
+    }
+
+    // Altezza casuale: 1 con probabilità 3/4, 2 con 3/16, ...
+    int randomHeight() {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        uint64_t r = seed | 1ULL << (2 * (MAX_LEVEL - 1));
+        return __builtin_ctzll(r) / 2 + 1;
+    }
+
+    static Node* next(const Node* n, int i) {
+        return n->links[i].next.load(std::memory_order_acquire);
+    }
+
+    static int width(const Node* n, int i) {
+        return n->links[i].width.load(std::memory_order_acquire);
+    }
+
+    static void setNext(Node* n, int i, Node* v) {
+        n->links[i].next.store(v, std::memory_order_release);
+    }
+
+    static void setWidth(Node* n, int i, int v) {
+        n->links[i].width.store(v, std::memory_order_release);
+    }
+
+    // Inizio e fine di una modifica (con writer bloccato)
+    void beginWrite() {
+        version.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Operazioni seq_cst: un lettore registrato nell'epoca e è partito dopo il
+    // cambio di epoca, quindi vede la lista senza i nodi tolti prima di quel cambio
+    void endWrite() {
+        version.fetch_add(1);
+        if (retired.empty() && retiredOld.empty()) return;
+        unsigned e = epoch.load();
+        if (readers[(e - 1) & 1].load() != 0) return;   // lettori dell'epoca precedente ancora attivi
+        // Solo i lettori delle epoche precedenti potevano raggiungere i nodi di retiredOld
+        for (Node* n : retiredOld) freeNode(n);
+        retiredOld.clear();
+        retiredOld.swap(retired);
+        epoch.store(e + 1);   // da qui i lettori dell'epoca e sono quelli "precedenti"
+    }
+
+    /**
+     * Esegue read() finché non trova una versione stabile.
+     * read() può vedere uno stato a metà di una modifica: deve solo seguire
+     * i puntatori (sempre validi) e il risultato viene scartato.
+     */
+    template <typename Read>
+    auto readConsistent(Read read) const -> decltype(read()) {
+        IndexableSkipList* self = const_cast<IndexableSkipList*>(this);
+        unsigned e;
+        for (;;) {
+            // Registrazione nell'epoca corrente: se intanto è cambiata si riprova
+            e = epoch.load();
+            self->readers[e & 1].fetch_add(1);
+            if (epoch.load() == e) break;
+            self->readers[e & 1].fetch_sub(1);
+        }
+        for (;;) {
+            unsigned v = version.load();
+            if (v & 1) {                           // modifica in corso
+                std::this_thread::yield();
+                continue;
+            }
+            auto result = read();
+            if (version.load(std::memory_order_relaxed) == v) {
+                self->readers[e & 1].fetch_sub(1);
+                return result;
+            }
+        }
+    }
+
+    // Per ogni livello l'ultimo nodo con chiave < key (o <= key se afterEqual) e la sua posizione
+    void findPredecessors(int key, bool afterEqual, Node** update, int* rank) const {
+        Node* x = head;
+        int pos = -1;
+        for (int i = level.load(std::memory_order_relaxed) - 1; i >= 0; i--) {
+            Node* n;
+            while ((n = next(x, i)) != nullptr && (n->key < key || (afterEqual && n->key == key))) {
+                pos += width(x, i);
+                x = n;
+            }
+            update[i] = x;
+            rank[i] = pos;
+        }
+    }
+
+    // Come findPredecessors, ma rispetto alla posizione: ultimo nodo prima di position
+    void findPredecessorsAt(int position, Node** update, int* rank) const {
+        Node* x = head;
+        int pos = -1;
+        for (int i = level.load(std::memory_order_relaxed) - 1; i >= 0; i--) {
+            while (next(x, i) != nullptr && pos + width(x, i) < position) {
+                pos += width(x, i);
+                x = next(x, i);
+            }
+            update[i] = x;
+            rank[i] = pos;
+        }
+    }
+
+    // Toglie il nodo che segue update[0] (con writer bloccato e versione dispari)
+    void unlink(Node** update) {
+        Node* x = next(update[0], 0);
+        int lv = level.load(std::memory_order_relaxed);
+        for (int i = 0; i < lv; i++) {
+            if (i < x->height && next(update[i], i) == x) {
+                setWidth(update[i], i, width(update[i], i) + width(x, i) - 1);
+                setNext(update[i], i, next(x, i));
+            } else {
+                setWidth(update[i], i, width(update[i], i) - 1);
+            }
+        }
+        while (lv > 1 && next(head, lv - 1) == nullptr) lv--;
+        level.store(lv, std::memory_order_release);
+        size_.store(size_.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+        retired.push_back(x);
+    }
+
+public:
+    // Constructor
+    IndexableSkipList() : level(1), size_(0), version(0), epoch(0), seed(88172645463325252ULL) {
+        readers[0].store(0);
+        readers[1].store(0);
+        head = newNode(0, MAX_LEVEL);
+        for (int i = 0; i < MAX_LEVEL; i++) setWidth(head, i, 1);   // da posizione -1 alla fine (posizione 0)
+    }
+
+    IndexableSkipList(const IndexableSkipList&) = delete;
+    IndexableSkipList& operator=(const IndexableSkipList&) = delete;
+
+    ~IndexableSkipList() {
+        Node* x = head;
+        while (x != nullptr) {
+            Node* n = next(x, 0);
+            freeNode(x);
+            x = n;
+        }
+        for (Node* n : retired) freeNode(n);
+        for (Node* n : retiredOld) freeNode(n);
+    }
+
+    //=== Modifiche (un thread alla volta) =====================================
+
+    // Inserisce key dopo le chiavi uguali; restituisce la posizione
+    int insert(int key) {
+        std::lock_guard<std::mutex> lock(writer);
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        findPredecessors(key, true, update, rank);
+        int h = randomHeight();
+        int lv = level.load(std::memory_order_relaxed);
+        int n = size_.load(std::memory_order_relaxed);
+        for (int i = lv; i < h; i++) {
+            update[i] = head;
+            rank[i] = -1;
+        }
+
+        int pos = rank[0] + 1;
+        Node* x = newNode(key, h);
+        for (int i = 0; i < h; i++) {
+            // Il nuovo nodo è completo prima di diventare raggiungibile
+            x->links[i].next.store(next(update[i], i), std::memory_order_relaxed);
+            x->links[i].width.store(i < lv ? width(update[i], i) - (pos - rank[i]) + 1 : n - pos + 1,
+                                    std::memory_order_relaxed);
+        }
+
+        beginWrite();
+        for (int i = 0; i < h; i++) {
+            setWidth(update[i], i, pos - rank[i]);
+            setNext(update[i], i, x);
+        }
+        for (int i = h; i < lv; i++) {
+            setWidth(update[i], i, width(update[i], i) + 1);
+        }
+        if (h > lv) level.store(h, std::memory_order_release);
+        size_.store(n + 1, std::memory_order_release);
+        endWrite();
+        return pos;
+    }
+
+    // Toglie la prima occorrenza di key; false se non c'è
+    bool remove(int key) {
+        std::lock_guard<std::mutex> lock(writer);
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        findPredecessors(key, false, update, rank);
+        Node* x = next(update[0], 0);
+        if (x == nullptr || x->key != key) return false;
+        beginWrite();
+        unlink(update);
+        endWrite();
+        return true;
+    }
+
+    // Delete from a specific position
+    bool removeAt(int position) {
+        std::lock_guard<std::mutex> lock(writer);
+        if (position < 0 || position >= size_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        findPredecessorsAt(position, update, rank);
+        beginWrite();
+        unlink(update);
+        endWrite();
+        return true;
+    }
+
+    // Nodi tolti ma non ancora liberati
+    size_t retiredCount() {
+        std::lock_guard<std::mutex> lock(writer);
+        return retired.size() + retiredOld.size();
+    }
+
+    //=== Letture (anche da più thread, senza lock) ============================
+
+    int size() const {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    // Search for an element: posizione della prima occorrenza, -1 se non c'è
+    int search(int key) const {
+        return readConsistent([&] {
+            Node* x = head;
+            int pos = -1;
+            for (int i = level.load(std::memory_order_acquire) - 1; i >= 0; i--) {
+                Node* n;
+                while ((n = next(x, i)) != nullptr && n->key < key) {
+                    pos += width(x, i);
+                    x = n;
+                }
+            }
+            Node* n = next(x, 0);
+            return n != nullptr && n->key == key ? pos + 1 : -1;
+        });
+    }
+
+    bool contains(int key) const {
+        return search(key) >= 0;
+    }
+
+    // Chiave in una posizione; false se la posizione non esiste
+    bool at(int position, int* key) const {
+        if (position < 0) return false;
+        struct Result { bool found; int key; };
+        Result r = readConsistent([&] {
+            Node* x = head;
+            int pos = -1;
+            for (int i = level.load(std::memory_order_acquire) - 1; i >= 0; i--) {
+                Node* n;
+                while ((n = next(x, i)) != nullptr && pos + width(x, i) <= position) {
+                    pos += width(x, i);
+                    x = n;
+                }
+            }
+            return Result{pos == position && x != head, x->key};
+        });
+        if (r.found) *key = r.key;
+        return r.found;
+    }
+
+    // Display the list (da non chiamare durante le modifiche)
+    void display() const {
+        if (size() == 0) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        uscitaTesto("Skip List: ");
+        for (Node* x = next(head, 0); x != nullptr; x = next(x, 0)) {
+            uscitaIntero(x->key);
+            uscitaTesto("(h");
+            uscitaIntero(x->height);
+            uscitaTesto(") -> ");
+        }
+        uscitaTesto("NULL\n");
+        uscitaSvuota();
+    }
+};
+
+#endif
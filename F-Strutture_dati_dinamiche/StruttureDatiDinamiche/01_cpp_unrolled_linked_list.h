@@ -0,0 +1,269 @@
+/** ****************************************************************************************
+* @file 01_cpp_unrolled_linked_list.h
+* @brief Lista concatenata "srotolata" (unrolled linked list): ogni nodo contiene un blocco di elementi
+*
+* In una lista normale (01_cpp_linked_list.cpp) ogni int ha il suo nodo e per
+* passare all'elemento successivo bisogna leggere un puntatore: se i nodi sono
+* sparsi in memoria quasi ogni passo è un cache miss.
+* Qui ogni nodo occupa esattamente una linea di cache (64 byte) e contiene fino
+* a CAPACITY elementi consecutivi (13 su un sistema a 64 bit): un puntatore ogni
+* 13 elementi invece di uno per elemento, e la ricerca dentro il blocco
+* confronta più elementi con una sola istruzione SIMD (AVX2 o SSE2, se il
+* compilatore li abilita; altrimenti un normale ciclo).
+*
+* Le operazioni sono quelle di LinkedList, con le stesse posizioni (da 0):
+*  - inserimento in una posizione: se il blocco è pieno viene diviso in due;
+*  - cancellazione: un blocco rimasto mezzo vuoto viene unito al successivo
+*    quando gli elementi ci stanno, così i blocchi restano pieni almeno a metà.
+*
+* Uso: #include "01_cpp_unrolled_linked_list.h" (vedi 01_bench_unrolled_linked_list.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <iostream>
+#include <string.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
+
+class UnrolledLinkedList {
+public:
+    // Elementi per blocco: il blocco (puntatore + contatore + dati) riempie una linea di cache
+    static const int CAPACITY = (int)((64 - sizeof(void*) - sizeof(int)) / sizeof(int));
+
+private:
+    struct alignas(64) Block {
+        Block* next;
+        int count;              // elementi usati in data
+        int data[CAPACITY];
+    };
+    static_assert(sizeof(Block) == 64, "un blocco deve occupare una linea di cache");
+    static_assert(CAPACITY >= 12, "la ricerca SIMD richiede almeno 12 elementi per blocco");
+
+    Block* head;
+    Block* tail;
+    int size_;
+    int blocks_;
+
+    Block* newBlock(Block* after) {
+        Block* b = new Block;
+        b->count = 0;
+        if (after == nullptr) {
+            b->next = head;
+            head = b;
+        } else {
+            b->next = after->next;
+            after->next = b;
+        }
+        if (b->next == nullptr) tail = b;
+        blocks_++;
+        return b;
+    }
+
+    void removeBlock(Block* prev, Block* b) {
+        if (prev == nullptr) head = b->next;
+        else prev->next = b->next;
+        if (tail == b) tail = prev;
+        delete b;
+        blocks_--;
+    }
+
+    // Indice del primo elemento uguale a key nel blocco, -1 se non c'è
+    static int findInBlock(const Block* b, int key) {
+#if defined(__AVX2__)
+        // Due confronti da 8 elementi: 0..7 e CAPACITY-8..CAPACITY-1 (si sovrappongono)
+        __m256i k = _mm256_set1_epi32(key);
+        __m256i lo = _mm256_loadu_si256((const __m256i*)b->data);
+        __m256i hi = _mm256_loadu_si256((const __m256i*)(b->data + CAPACITY - 8));
+        unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lo, k)));
+        mask |= (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(hi, k))) << (CAPACITY - 8);
+#elif defined(__SSE2__)
+        // Quattro confronti da 4 elementi: 0..3, 4..7, 8..11 e CAPACITY-4..CAPACITY-1
+        __m128i k = _mm_set1_epi32(key);
+        unsigned mask = 0;
+        for (int i = 0; i < 12; i += 4) {
+            __m128i v = _mm_loadu_si128((const __m128i*)(b->data + i));
+            mask |= (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, k))) << i;
+        }
+        __m128i v = _mm_loadu_si128((const __m128i*)(b->data + CAPACITY - 4));
+        mask |= (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, k))) << (CAPACITY - 4);
+#else
+        unsigned mask = 0;
+        for (int i = 0; i < CAPACITY; i++) {
+            mask |= (unsigned)(b->data[i] == key) << i;
+        }
+#endif
+        mask &= (1u << b->count) - 1;   // solo gli elementi usati
+        return mask ? __builtin_ctz(mask) : -1;
+    }
+
+    // Blocco che contiene la posizione (0 <= position < size_); position diventa l'indice nel blocco
+    Block* locate(int& position, Block** prev) const {
+        Block* p = nullptr;
+        Block* b = head;
+        while (position >= b->count) {
+            position -= b->count;
+            p = b;
+            b = b->next;
+        }
+        if (prev != nullptr) *prev = p;
+        return b;
+    }
+
+public:
+    // Constructor
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), size_(0), blocks_(0) {}
+
+    UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+
+    ~UnrolledLinkedList() {
+        while (head != nullptr) {
+            Block* next = head->next;
+            delete head;
+            head = next;
+        }
+    }
+
+    int size() const { return size_; }
+    int blocks() const { return blocks_; }
+
+    // Insert at the beginning
+    void insertAtBeginning(int data) {
+        insertAtPosition(data, 0);
+    }
+
+    // Insert at the end: i blocchi riempiti in ordine restano pieni
+    void insertAtEnd(int data) {
+        Block* b = tail;
+        if (b == nullptr || b->count == CAPACITY) {
+            b = newBlock(tail);
+        }
+        b->data[b->count++] = data;
+        size_++;
+    }
+
+    // Insert at a specific position
+    void insertAtPosition(int data, int position) {
+        if (position < 0 || position > size_) {
+            std::cout << "Position out of range!" << std::endl;
+            return;
+        }
+        if (position == size_) {
+            insertAtEnd(data);
+            return;
+        }
+
+        Block* b = locate(position, nullptr);
+        if (b->count == CAPACITY) {
+            // Blocco pieno: metà degli elementi passano in un nuovo blocco
+            Block* nb = newBlock(b);
+            int half = CAPACITY / 2;
+            nb->count = CAPACITY - half;
+            memcpy(nb->data, b->data + half, nb->count * sizeof(int));
+            b->count = half;
+            if (position > half) {
+                position -= half;
+                b = nb;
+            }
+        }
+        memmove(b->data + position + 1, b->data + position, (b->count - position) * sizeof(int));
+        b->data[position] = data;
+        b->count++;
+        size_++;
+    }
+
+    // Delete from the beginning
+    void deleteFromBeginning() {
+        deleteFromPosition(0);
+    }
+
+    // Delete from the end
+    void deleteFromEnd() {
+        deleteFromPosition(size_ - 1);
+    }
+
+    // Delete from a specific position
+    void deleteFromPosition(int position) {
+        if (head == nullptr) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        if (position < 0 || position >= size_) {
+            std::cout << "Position out of range!" << std::endl;
+            return;
+        }
+
+        Block* prev;
+        Block* b = locate(position, &prev);
+        b->count--;
+        memmove(b->data + position, b->data + position + 1, (b->count - position) * sizeof(int));
+        size_--;
+
+        if (b->count == 0) {
+            removeBlock(prev, b);
+        } else if (b->count < CAPACITY / 2 && b->next != nullptr && b->count + b->next->count <= CAPACITY) {
+            // Blocco mezzo vuoto: si unisce al successivo
+            Block* next = b->next;
+            memcpy(b->data + b->count, next->data, next->count * sizeof(int));
+            b->count += next->count;
+            removeBlock(b, next);
+        }
+    }
+
+    // Search for an element: posizione della prima occorrenza, -1 se non c'è
+    int search(int key) const {
+        int position = 0;
+        for (const Block* b = head; b != nullptr; b = b->next) {
+            int i = findInBlock(b, key);
+            if (i >= 0) {
+                return position + i;
+            }
+            position += b->count;
+        }
+        return -1;
+    }
+
+    // Elemento in una posizione (0 <= position < size())
+    int at(int position) const {
+        const Block* b = locate(position, nullptr);
+        return b->data[position];
+    }
+
+    // Chiama f(elemento) per tutti gli elementi, dal primo all'ultimo
+    template <typename F>
+    void forEach(F f) const {
+        for (const Block* b = head; b != nullptr; b = b->next) {
+            for (int i = 0; i < b->count; i++) {
+                f(b->data[i]);
+            }
+        }
+    }
+
+    // Display the list, un blocco tra parentesi quadre
+    void display() const {
+        if (head == nullptr) {
+            std::cout << "List is empty!" << std::endl;
+            return;
+        }
+        uscitaTesto("Unrolled Linked List: ");
+        for (const Block* b = head; b != nullptr; b = b->next) {
+            uscitaCarattere('[');
+            for (int i = 0; i < b->count; i++) {
+                if (i > 0) uscitaCarattere(' ');
+                uscitaIntero(b->data[i]);
+            }
+            uscitaTesto("] -> ");
+        }
+        uscitaTesto("NULL\n");
+        uscitaSvuota();
+    }
+};
+
+#endif
@@ -0,0 +1,310 @@
+/** ****************************************************************************************
+* @file 02_bench_bracket_checker.c
+* @brief Controllo delle parentesi su un testo di 1 GB: areParenthesesBalanced contro BracketChecker
+*
+* 1) Verifica: 20000 stringhe casuali di parentesi e lettere (anche molto
+*    annidate) controllate con una versione semplice di riferimento e con
+*    BracketChecker: tutto in una volta, a pezzi di lunghezza casuale e in
+*    parallelo da 2 a 7 thread. Tipo e posizione dell'errore devono coincidere.
+* 2) GB/s su un testo simile a un JSON (oggetti e liste annidati fino a 60
+*    livelli, testo fra le parentesi):
+*    - areParenthesesBalanced originale (pila di 100 elementi, un byte alla volta);
+*    - BracketChecker senza SIMD (un byte alla volta, pila che cresce);
+*    - bracketCheckerFeed a blocchi di 1 MB (maschere SIMD);
+*    - bracketCheckerFeedParallel a blocchi di 64 MB con 2, 4 e tutti i thread.
+*    Poi lo stesso testo con un errore ai 3/4: tutti devono trovarlo nello stesso punto.
+*
+* Compilazione ed esecuzione:
+*   gcc -std=c99 -O2 -march=native -pthread 02_bench_bracket_checker.c -o bench_bracket
+*   ./bench_bracket [MB di testo, default 1024]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#define BRACKET_CHECKER_PARALLEL   // bracketCheckerFeedParallel
+#include "02_c_bracket_checker.h"
+
+static double seconds(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint64_t seed = 88172645463325252ULL;
+
+static uint64_t xorshift(void) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+//------------------------------------------------------------------------------------------
+//=== VERSIONI DI CONFRONTO ================================================================
+//------------------------------------------------------------------------------------------
+
+// areParenthesesBalanced di 02_c_stack.c com'era, con la sua ArrayStack di 100 elementi
+#define MAX_SIZE 100
+
+static bool originalBalanced(const char* expr) {
+    int items[MAX_SIZE];
+    int top = -1;
+    for (size_t i = 0; expr[i] != '\0'; i++) {
+        if (expr[i] == '(' || expr[i] == '[' || expr[i] == '{') {
+            if (top == MAX_SIZE - 1) return false;   // l'originale stampava "Stack Overflow!"
+            items[++top] = expr[i];
+        } else if (expr[i] == ')' || expr[i] == ']' || expr[i] == '}') {
+            if (top == -1) return false;
+            int open = items[top--];
+            if ((expr[i] == ')' && open != '(') || (expr[i] == ']' && open != '[') ||
+                (expr[i] == '}' && open != '{')) {
+                return false;
+            }
+        }
+    }
+    return top == -1;
+}
+
+// BracketChecker senza maschere SIMD: bracketStep su ogni parentesi trovata byte per byte
+static bool scalarCheck(BracketChecker* checker, const char* buf, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        char c = buf[i];
+        if (c == '(' || c == ')' || c == '[' || c == ']' || c == '{' || c == '}') {
+            if (!bracketStep(&checker->stack, NULL, c, i, &checker->error)) return false;
+        }
+    }
+    checker->offset = n;
+    return true;
+}
+
+// Riferimento per la verifica: il più semplice possibile
+static BracketError reference(const char* s, size_t n) {
+    BracketError e = {BRACKET_OK, BRACKET_NONE, BRACKET_NONE};
+    size_t capacity = 16, top = 0;
+    size_t* open = (size_t*)malloc(capacity * sizeof(size_t));
+    for (size_t i = 0; i < n; i++) {
+        const char* o = strchr("([{", s[i]);
+        const char* c = strchr(")]}", s[i]);
+        if (s[i] != '\0' && o != NULL) {
+            if (top == capacity) {
+                capacity *= 2;
+                open = (size_t*)realloc(open, capacity * sizeof(size_t));
+            }
+            open[top++] = i;
+        } else if (s[i] != '\0' && c != NULL) {
+            if (top == 0) {
+                e.kind = BRACKET_UNEXPECTED_CLOSE;
+                e.offset = i;
+                break;
+            }
+            if (s[open[top - 1]] != "([{"[c - ")]}"]) {
+                e.kind = BRACKET_MISMATCH;
+                e.offset = i;
+                e.openOffset = open[top - 1];
+                break;
+            }
+            top--;
+        }
+    }
+    if (e.kind == BRACKET_OK && top > 0) {
+        e.kind = BRACKET_UNCLOSED;
+        e.offset = open[top - 1];
+    }
+    free(open);
+    return e;
+}
+
+static bool sameError(BracketError a, BracketError b) {
+    return a.kind == b.kind && a.offset == b.offset && a.openOffset == b.openOffset;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verify(void) {
+    static char s[4000];
+    for (int test = 0; test < 20000; test++) {
+        size_t n = xorshift() % sizeof(s);
+        // Stringa bilanciata con qualche modifica casuale (a volte nessuna)
+        char stack[4000];
+        size_t top = 0;
+        for (size_t i = 0; i < n; i++) {
+            uint64_t r = xorshift() % 10;
+            if (r < 4 && i + top + 1 < n) {
+                stack[top] = "([{"[xorshift() % 3];
+                s[i] = stack[top++];
+            } else if (r < 8 && top > 0) {
+                char o = stack[--top];
+                s[i] = o == '(' ? ')' : o == '[' ? ']' : '}';
+            } else {
+                s[i] = "ab x"[xorshift() % 4];
+            }
+        }
+        for (int k = (int)(xorshift() % 3); k > 0 && n > 0; k--) s[xorshift() % n] = "()[]{}a"[xorshift() % 7];
+        BracketError expected = reference(s, n);
+
+        BracketChecker whole, pieces, parallel;
+        bracketCheckerInit(&whole);
+        bracketCheckerFeed(&whole, s, n);
+        bracketCheckerFinish(&whole);
+
+        bracketCheckerInit(&pieces);
+        for (size_t i = 0; i < n;) {
+            size_t len = xorshift() % 200;
+            if (len > n - i) len = n - i;
+            bracketCheckerFeed(&pieces, s + i, len);
+            i += len;
+        }
+        bracketCheckerFinish(&pieces);
+
+        bracketCheckerInit(&parallel);
+        int threads = 2 + test % 6;
+        size_t half = n / 2;
+        bracketCheckerFeedParallel(&parallel, s, half, threads);
+        bracketCheckerFeedParallel(&parallel, s + half, n - half, threads);
+        bracketCheckerFinish(&parallel);
+
+        bool ok = sameError(whole.error, expected) && sameError(pieces.error, expected) &&
+                  sameError(parallel.error, expected);
+        bracketCheckerFree(&whole);
+        bracketCheckerFree(&pieces);
+        bracketCheckerFree(&parallel);
+        if (!ok) {
+            printf("ERRORE nella stringa %d (%zu caratteri)\n", test, n);
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+
+// Testo simile a un JSON annidato: {"k": [1, 2, {"k": (x)}], ...}
+static void generate(char* text, size_t n) {
+    char stack[64];
+    int top = 0;
+    size_t i = 0;
+    while (i < n) {
+        size_t remaining = n - i;
+        uint64_t r = xorshift() % 16;
+        if ((size_t)top >= remaining) {   // si chiude tutto prima della fine
+            char o = stack[--top];
+            text[i++] = o == '(' ? ')' : o == '[' ? ']' : '}';
+        } else if (r < 3 && top < 60 && remaining > (size_t)top + 2) {
+            stack[top] = "{[{("[xorshift() % 4];
+            text[i++] = stack[top++];
+        } else if (r < 6 && top > 0) {
+            char o = stack[--top];
+            text[i++] = o == '(' ? ')' : o == '[' ? ']' : '}';
+        } else {
+            // Un pezzo di testo senza parentesi, come "chiave": 12345,
+            static const char words[] = "\"valore\": 12345, \"nome\": \"Filippo\", true, 3.14, ";
+            size_t len = 4 + xorshift() % 40;
+            if (len > remaining - top) len = remaining - top;
+            for (size_t k = 0; k < len; k++) text[i++] = words[(k + r) % (sizeof(words) - 1)];
+        }
+    }
+}
+
+typedef struct {
+    double seconds;
+    BracketError error;
+} Run;
+
+static Run runFeed(const char* text, size_t n, size_t block, int threads) {
+    BracketChecker checker;
+    Run run;
+    double start = seconds();
+    bracketCheckerInit(&checker);
+    for (size_t i = 0; i < n; i += block) {
+        size_t len = n - i < block ? n - i : block;
+        bool ok = threads > 1 ? bracketCheckerFeedParallel(&checker, text + i, len, threads)
+                              : bracketCheckerFeed(&checker, text + i, len);
+        if (!ok) break;
+    }
+    bracketCheckerFinish(&checker);
+    run.seconds = seconds() - start;
+    run.error = checker.error;
+    bracketCheckerFree(&checker);
+    return run;
+}
+
+static Run runScalar(const char* text, size_t n) {
+    BracketChecker checker;
+    Run run;
+    double start = seconds();
+    bracketCheckerInit(&checker);
+    scalarCheck(&checker, text, n);
+    bracketCheckerFinish(&checker);
+    run.seconds = seconds() - start;
+    run.error = checker.error;
+    bracketCheckerFree(&checker);
+    return run;
+}
+
+static void report(const char* name, Run run, size_t n, BracketError expected) {
+    printf("%-40s %8.2f GB/s   ", name, n / run.seconds / 1e9);
+    if (sameError(run.error, expected)) printf("ok\n");
+    else printf("ERRORE (tipo %d al byte %llu)\n", (int)run.error.kind, (unsigned long long)run.error.offset);
+}
+
+static void timeAll(const char* text, size_t n, BracketError expected) {
+    int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int threads[3] = {2, 4, cores};
+    char name[64];
+
+    double start = seconds();
+    bool balanced = originalBalanced(text);
+    double t = seconds() - start;
+    printf("%-40s %8.2f GB/s   %s\n", "areParenthesesBalanced originale", n / t / 1e9,
+           balanced == (expected.kind == BRACKET_OK) ? "ok" : "ERRORE");
+
+    report("BracketChecker senza SIMD", runScalar(text, n), n, expected);
+    report("bracketCheckerFeed (blocchi da 1 MB)", runFeed(text, n, 1 << 20, 1), n, expected);
+    for (int k = 0; k < 3; k++) {
+        if (k == 2 && (cores < 3 || cores == 4)) break;   // già misurato
+        snprintf(name, sizeof(name), "bracketCheckerFeedParallel, %d thread", threads[k]);
+        report(name, runFeed(text, n, (size_t)64 << 20, threads[k]), n, expected);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t mb = argc > 1 ? (size_t)atol(argv[1]) : 1024;
+    size_t n = mb << 20;
+    bool ok = verify();
+    printf("Verifica: %s\n\n", ok ? "stessi risultati del riferimento" : "ERRORE");
+    fflush(stdout);
+
+    char* text = (char*)malloc(n + 1);
+    if (text == NULL) {
+        printf("Memoria insufficiente per %zu MB\n", mb);
+        return 1;
+    }
+    generate(text, n);
+    text[n] = '\0';
+    size_t brackets = 0;
+    for (size_t i = 0; i < n; i++) brackets += strchr("()[]{}", text[i]) != NULL && text[i] != '\0';
+    printf("Testo bilanciato di %zu MB (%.1f%% parentesi), %ld core\n", mb, 100.0 * brackets / n,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    BracketError none = {BRACKET_OK, BRACKET_NONE, BRACKET_NONE};
+    timeAll(text, n, none);
+
+    // Un errore ai 3/4: la prima parentesi chiusa da lì in poi diventa sbagliata
+    size_t at = n / 4 * 3;
+    while (strchr(")]}", text[at]) == NULL || text[at] == '\0') at++;
+    text[at] = text[at] == ')' ? ']' : ')';
+    BracketError expected = reference(text, n);
+    printf("\nStesso testo con una parentesi sbagliata al byte %llu\n", (unsigned long long)expected.offset);
+    timeAll(text, n, expected);
+    free(text);
+    return ok ? 0 : 1;
+}
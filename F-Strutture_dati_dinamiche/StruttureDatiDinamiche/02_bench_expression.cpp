@@ -0,0 +1,314 @@
+/** ****************************************************************************************
+* @file 02_bench_expression.cpp
+* @brief Milioni di espressioni: rilettura del testo ogni volta contro ExpressionEvaluator con cache
+*
+* 1) Verifica: 20000 espressioni casuali generate da un albero (con il valore
+*    calcolato sull'albero e solo le parentesi necessarie, più qualcuna in
+*    più) devono dare lo stesso valore con evaluate e con la valutazione
+*    diretta; le stesse espressioni con un carattere tolto o aggiunto devono
+*    essere giudicate valide o non valide allo stesso modo.
+* 2) Espressioni al secondo: 1000 espressioni diverse con le variabili x, y, z
+*    (fra 5 e 30 simboli), valutate a turno N volte in totale, cambiando le
+*    variabili ad ogni giro:
+*    - valutazione diretta: shunting-yard con due std::stack che calcola
+*      mentre legge, quindi rilegge il testo ad ogni valutazione;
+*    - compile + run ad ogni valutazione (bytecode, senza cache);
+*    - evaluate (cache indicizzata dal testo);
+*    - run di programmi già compilati (il limite inferiore).
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 02_bench_expression.cpp -o bench_expression
+*   ./bench_expression [N, default 10000000]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <stack>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "02_cpp_expression.h"
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static const char* VARIABLES[3] = {"x", "y", "z"};
+
+//------------------------------------------------------------------------------------------
+//=== VALUTAZIONE DIRETTA ==================================================================
+//------------------------------------------------------------------------------------------
+
+// Shunting-yard che applica subito ogni operatore: nessun bytecode, il testo
+// viene riletto ad ogni chiamata. Stessa sintassi e stesse precedenze di
+// ExpressionEvaluator.
+static bool directEvaluate(const std::string& text, const double vars[3], double& result) {
+    enum { ADD, SUB, MUL, DIV, MOD, POW, NEG, PAREN };
+    static const int prec[] = {1, 1, 2, 2, 2, 4, 3, 0};
+    std::stack<double> values;
+    std::stack<int> ops;
+    auto apply = [&](int op) {
+        double b = values.top();
+        if (op == NEG) {
+            values.top() = -b;
+            return;
+        }
+        values.pop();
+        double& a = values.top();
+        switch (op) {
+            case ADD: a += b; break;
+            case SUB: a -= b; break;
+            case MUL: a *= b; break;
+            case DIV: a /= b; break;
+            case MOD: a = std::fmod(a, b); break;
+            default:  a = std::pow(a, b); break;
+        }
+    };
+    bool expectOperand = true;
+    size_t i = 0, n = text.size();
+    while (i < n) {
+        char c = text[i];
+        if (c == ' ') {
+            i++;
+        } else if (expectOperand) {
+            if ((c >= '0' && c <= '9') || c == '.') {
+                char* end;
+                values.push(strtod(text.c_str() + i, &end));
+                if (end == text.c_str() + i) return false;
+                i = end - text.c_str();
+                expectOperand = false;
+            } else if (isalpha((unsigned char)c)) {
+                size_t start = i;
+                while (i < n && isalnum((unsigned char)text[i])) i++;
+                int v = 0;
+                while (v < 3 && text.compare(start, i - start, VARIABLES[v]) != 0) v++;
+                if (v == 3) return false;
+                values.push(vars[v]);
+                expectOperand = false;
+            } else if (c == '(' || c == '-') {
+                ops.push(c == '(' ? PAREN : NEG);
+                i++;
+            } else if (c == '+') {
+                i++;
+            } else {
+                return false;
+            }
+        } else if (c == ')') {
+            while (!ops.empty() && ops.top() != PAREN) {
+                apply(ops.top());
+                ops.pop();
+            }
+            if (ops.empty()) return false;
+            ops.pop();
+            i++;
+        } else {
+            const char* symbols = "+-*/%^";
+            const char* s = strchr(symbols, c);
+            if (c == '\0' || s == NULL) return false;
+            int op = (int)(s - symbols);
+            while (!ops.empty() && ops.top() != PAREN &&
+                   (prec[ops.top()] > prec[op] || (prec[ops.top()] == prec[op] && op != POW))) {
+                apply(ops.top());
+                ops.pop();
+            }
+            ops.push(op);
+            expectOperand = true;
+            i++;
+        }
+    }
+    if (expectOperand) return false;
+    while (!ops.empty()) {
+        if (ops.top() == PAREN) return false;
+        apply(ops.top());
+        ops.pop();
+    }
+    result = values.top();
+    return true;
+}
+
+//------------------------------------------------------------------------------------------
+//=== ESPRESSIONI CASUALI ==================================================================
+//------------------------------------------------------------------------------------------
+
+// Genera un'espressione di profondità al massimo depth: restituisce il testo,
+// in value il valore e in prec la precedenza dell'operatore principale
+// (5 per numeri, variabili e parentesi)
+static std::string generate(std::mt19937& gen, int depth, const double vars[3], double& value, int& prec) {
+    static const char symbols[] = "+-*/%^";
+    static const int precs[] = {1, 1, 2, 2, 2, 4};
+    int kind = depth == 0 ? gen() % 2 : gen() % 10;
+    std::string text;
+    if (kind == 0) {
+        char number[32];
+        value = gen() % 4 == 0 ? (gen() % 40) / 4.0 : gen() % 100;
+        snprintf(number, sizeof(number), "%g", value);
+        text = number;
+        prec = 5;
+    } else if (kind == 1) {
+        int v = gen() % 3;
+        value = vars[v];
+        text = VARIABLES[v];
+        prec = 5;
+    } else if (kind == 2) {
+        double a;
+        int pa;
+        std::string child = generate(gen, depth - 1, vars, a, pa);
+        if (pa < 3) child = "(" + child + ")";
+        value = -a;
+        text = "-" + child;
+        prec = 3;
+    } else {
+        int op = gen() % 6;
+        double a, b;
+        int pa, pb;
+        std::string left = generate(gen, depth - 1, vars, a, pa);
+        std::string right = generate(gen, depth - 1, vars, b, pb);
+        int p = precs[op];
+        bool power = op == 5;
+        if (pa < p || (pa == p && power) || gen() % 8 == 0) left = "(" + left + ")";
+        if (pb < p || (pb == p && !power) || gen() % 8 == 0) right = "(" + right + ")";
+        switch (op) {
+            case 0: value = a + b; break;
+            case 1: value = a - b; break;
+            case 2: value = a * b; break;
+            case 3: value = a / b; break;
+            case 4: value = std::fmod(a, b); break;
+            default: value = std::pow(a, b); break;
+        }
+        text = left + (gen() % 2 ? " " : "") + symbols[op] + (gen() % 2 ? " " : "") + right;
+        prec = p;
+    }
+    return text;
+}
+
+static bool same(double a, double b) {
+    return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verify() {
+    std::mt19937 gen(7);
+    ExpressionEvaluator evaluator(1000);   // cache piccola: viene anche svuotata
+    double vars[3];
+    for (int test = 0; test < 20000; test++) {
+        for (int v = 0; v < 3; v++) {
+            vars[v] = (int)(gen() % 21) - 10;
+            evaluator.setVariable(VARIABLES[v], vars[v]);
+        }
+        double expected, result, direct;
+        int prec;
+        std::string text = generate(gen, 1 + test % 6, vars, expected, prec);
+        if (!evaluator.evaluate(text, result) || !same(result, expected) ||
+            !directEvaluate(text, vars, direct) || !same(direct, expected)) {
+            printf("ERRORE: %s = %g, evaluate %g, diretta %g\n", text.c_str(), expected, result, direct);
+            return false;
+        }
+        // Un carattere tolto o aggiunto: valida o no per entrambi, con lo stesso valore
+        size_t pos = gen() % text.size();
+        if (gen() % 2) text.erase(pos, 1);
+        else text.insert(pos, 1, "()+-*/^%x1. "[gen() % 12]);
+        bool ok = evaluator.evaluate(text, result);
+        if (ok != directEvaluate(text, vars, direct) || (ok && !same(result, direct))) {
+            printf("ERRORE: \"%s\" %s\n", text.c_str(), ok ? "valida solo per evaluate" : "valida solo diretta");
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    const int K = 1000;
+    bool ok = verify();
+    printf("Verifica: %s\n\n", ok ? "stessi valori dell'albero, stessi errori" : "ERRORE");
+    fflush(stdout);
+
+    std::mt19937 gen(42);
+    double vars[3] = {1.5, -2, 3};
+    std::vector<std::string> texts;
+    size_t chars = 0;
+    while ((int)texts.size() < K) {
+        double value;
+        int prec;
+        std::string text = generate(gen, 4, vars, value, prec);
+        if (text.size() < 5 || text.size() > 30) continue;
+        chars += text.size();
+        texts.push_back(text);
+    }
+    long rounds = n / K;
+    n = rounds * K;
+
+    // Ogni modalità somma i risultati: le somme devono coincidere
+    ExpressionEvaluator evaluator;
+    auto setRound = [&](long r) {
+        for (int v = 0; v < 3; v++) {
+            vars[v] = (double)((r + v) % 7) - 3;
+            evaluator.setVariable(VARIABLES[v], vars[v]);
+        }
+    };
+    double sums[4] = {0, 0, 0, 0}, times[4];
+    double result;
+
+    auto start = std::chrono::steady_clock::now();
+    for (long r = 0; r < rounds; r++) {
+        setRound(r);
+        for (int k = 0; k < K; k++) {
+            directEvaluate(texts[k], vars, result);
+            sums[0] += result;
+        }
+    }
+    times[0] = seconds(start);
+
+    ExpressionProgram program;
+    start = std::chrono::steady_clock::now();
+    for (long r = 0; r < rounds; r++) {
+        setRound(r);
+        for (int k = 0; k < K; k++) {
+            evaluator.compile(texts[k], program);
+            sums[1] += evaluator.run(program);
+        }
+    }
+    times[1] = seconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (long r = 0; r < rounds; r++) {
+        setRound(r);
+        for (int k = 0; k < K; k++) {
+            evaluator.evaluate(texts[k], result);
+            sums[2] += result;
+        }
+    }
+    times[2] = seconds(start);
+
+    std::vector<ExpressionProgram> programs(K);
+    for (int k = 0; k < K; k++) evaluator.compile(texts[k], programs[k]);
+    start = std::chrono::steady_clock::now();
+    for (long r = 0; r < rounds; r++) {
+        setRound(r);
+        for (int k = 0; k < K; k++) sums[3] += evaluator.run(programs[k]);
+    }
+    times[3] = seconds(start);
+
+    const char* names[4] = {"valutazione diretta (due pile)", "compile + run ogni volta",
+                            "evaluate (con cache)", "run di programmi compilati"};
+    printf("%ld valutazioni di %d espressioni diverse (in media %.1f caratteri)\n", n, K, (double)chars / K);
+    printf("%-34s %16s %10s\n", "", "milioni espr./s", "ns/espr.");
+    for (int m = 0; m < 4; m++) {
+        printf("%-34s %16.2f %10.1f\n", names[m], n / times[m] / 1e6, times[m] / n * 1e9);
+        if (!same(sums[m], sums[0])) {
+            printf("ERRORE: somma dei risultati diversa (%g invece di %g)\n", sums[m], sums[0]);
+            ok = false;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/** ****************************************************************************************
+* @file 02_bench_lockfree_stack.cpp
+* @brief Pila condivisa da 1 a 64 thread: LinkedStack con mutex contro LockFreeStack
+*
+* 1) Verifica: 8 thread fanno push di valori tutti diversi e pop in ordine
+*    casuale, con e senza eliminazione; alla fine (svuotando la pila) ogni
+*    valore inserito deve essere stato tolto esattamente una volta.
+* 2) Milioni di operazioni al secondo con 1, 2, 4... 64 thread che fanno
+*    coppie push + pop (come una lista di blocchi liberi condivisa) su una
+*    pila che contiene già 1000 elementi, N operazioni in totale:
+*    - LinkedStack (02_cpp_stack.h) protetta da un std::mutex;
+*    - LockFreeStack senza eliminazione (solo pila di Treiber);
+*    - LockFreeStack con 16 caselle di eliminazione.
+*    Con più thread che core i thread si alternano sugli stessi core: un thread
+*    sospeso mentre tiene il mutex ferma tutti gli altri, uno sospeso durante
+*    una compare_exchange no.
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 -pthread 02_bench_lockfree_stack.cpp -o bench_lockfree_stack
+*   ./bench_lockfree_stack [N, default 8000000]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+#include "02_cpp_stack.h"
+#include "02_cpp_lockfree_stack.h"
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Avvia threads thread che eseguono work(t) insieme; restituisce i secondi dal via all'ultimo join
+template <typename Work>
+static double runThreads(int threads, Work work) {
+    std::atomic<bool> go(false);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            work(t);
+        });
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& th : pool) th.join();
+    return seconds(start);
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verify(int eliminationSlots) {
+    const int THREADS = 8, OPS = 100000;
+    LockFreeStack stack(THREADS * OPS, eliminationSlots);
+    std::vector<std::vector<int>> popped(THREADS);
+    runThreads(THREADS, [&](int t) {
+        std::mt19937 gen(t);
+        int next = 0;
+        for (int i = 0; i < OPS; i++) {
+            int value;
+            if (gen() % 2 == 0) {
+                if (!stack.push(t * OPS + next++)) {
+                    printf("ERRORE: pila piena\n");
+                    exit(1);
+                }
+            } else if (stack.pop(value)) {
+                popped[t].push_back(value);
+            }
+        }
+    });
+    std::vector<int> count(THREADS * OPS, 0);
+    int value, remaining = stack.size();
+    for (auto& values : popped)
+        for (int v : values) count[v]++;
+    while (stack.pop(value)) {
+        count[value]++;
+        remaining--;
+    }
+    // I valori inseriti sono quelli da t * OPS in su per ogni thread: ogni valore deve comparire una volta
+    for (int t = 0; t < THREADS; t++) {
+        int pushed = 0;
+        while (pushed < OPS && count[t * OPS + pushed] > 0) pushed++;
+        for (int i = 0; i < OPS; i++) {
+            if (count[t * OPS + i] != (i < pushed ? 1 : 0)) return false;
+        }
+    }
+    return remaining == 0 && stack.isEmpty();
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+static const int PREFILL = 1000;
+
+static double timeMutex(int threads, long ops) {
+    LinkedStack stack;
+    std::mutex lock;
+    for (int i = 0; i < PREFILL; i++) stack.push(i);
+    double t = runThreads(threads, [&](int) {
+        int value;
+        for (long i = 0; i < ops / threads / 2; i++) {
+            {
+                std::lock_guard<std::mutex> g(lock);
+                stack.push((int)i);
+            }
+            std::lock_guard<std::mutex> g(lock);
+            if (!stack.isEmpty()) stack.pop(value);
+        }
+    });
+    return ops / t / 1e6;
+}
+
+static double timeLockFree(int threads, long ops, int eliminationSlots) {
+    LockFreeStack stack(PREFILL + threads, eliminationSlots);
+    for (int i = 0; i < PREFILL; i++) stack.push(i);
+    double t = runThreads(threads, [&](int) {
+        int value;
+        for (long i = 0; i < ops / threads / 2; i++) {
+            stack.push((int)i);
+            stack.pop(value);
+        }
+    });
+    if (stack.size() != PREFILL) printf("ERRORE: %d elementi invece di %d\n", stack.size(), PREFILL);
+    return ops / t / 1e6;
+}
+
+int main(int argc, char* argv[]) {
+    long ops = argc > 1 ? atol(argv[1]) : 8000000;
+    bool ok = verify(0) && verify(16);
+    printf("Verifica: %s\n\n", ok ? "ogni valore tolto esattamente una volta" : "ERRORE");
+    fflush(stdout);
+
+    printf("Milioni di operazioni al secondo (push + pop), %ld operazioni, %u core\n", ops,
+           std::thread::hardware_concurrency());
+    printf("%8s %18s %18s %18s\n", "thread", "mutex+LinkedStack", "Treiber", "Treiber+elimin.");
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        printf("%8d %18.2f %18.2f %18.2f\n", threads, timeMutex(threads, ops), timeLockFree(threads, ops, 0),
+               timeLockFree(threads, ops, 16));
+        fflush(stdout);
+    }
+    return ok ? 0 : 1;
+}
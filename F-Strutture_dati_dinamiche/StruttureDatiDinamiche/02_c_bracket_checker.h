@@ -0,0 +1,331 @@
+/** ****************************************************************************************
+* @file 02_c_bracket_checker.h
+* @brief Controllo delle parentesi ( ) [ ] { } su flussi di qualunque dimensione, anche in parallelo
+*
+* È l'algoritmo di areParenthesesBalanced in 02_c_stack.c (ogni parentesi
+* aperta va sulla pila, ogni chiusa deve corrispondere a quella in cima), con
+* tre differenze:
+*  - la pila cresce quando serve (realloc), quindi nessun limite di annidamento;
+*  - il testo arriva a pezzi (bracketCheckerFeed), ad esempio letto da un file
+*    di qualche GB un blocco alla volta; in caso di errore si conosce la
+*    posizione (in byte dall'inizio) della parentesi sbagliata;
+*  - le parentesi vengono trovate 64 byte alla volta: con AVX2 o SSE2 (se il
+*    compilatore li abilita) pochi confronti SIMD danno una maschera di bit
+*    delle posizioni delle parentesi, e il ciclo visita solo quelle.
+* Come in areParenthesesBalanced, ogni carattere parentesi conta, anche dentro
+* stringhe o commenti.
+*
+* Modalità parallela (bracketCheckerFeedParallel, solo se prima dell'include è
+* definita BRACKET_CHECKER_PARALLEL): il blocco viene diviso in
+* parti controllate contemporaneamente da più thread; ogni parte produce un
+* riassunto: le parentesi chiuse che non trovano la loro aperta nella parte
+* (andranno confrontate con la pila delle parti precedenti), le aperte rimaste
+* aperte alla fine e l'eventuale primo errore interno. I riassunti vengono poi
+* combinati in ordine: il risultato, compresa la posizione del primo errore, è
+* lo stesso del controllo sequenziale.
+*
+* Esempio:
+*   BracketChecker checker;
+*   bracketCheckerInit(&checker);
+*   while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+*       if (!bracketCheckerFeed(&checker, buffer, n)) break;
+*   if (!bracketCheckerFinish(&checker))
+*       printf("Errore al byte %llu\n", (unsigned long long)checker.error.offset);
+*   bracketCheckerFree(&checker);
+*
+* Uso: #include "02_c_bracket_checker.h" (vedi 02_c_stack.c e 02_bench_bracket_checker.c).
+* Per bracketCheckerFeedParallel, che richiede i thread POSIX:
+*   #define BRACKET_CHECKER_PARALLEL
+*   #include "02_c_bracket_checker.h"
+* e compilare con gcc ... -pthread.
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef BRACKET_CHECKER_H
+#define BRACKET_CHECKER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#define BRACKET_NONE UINT64_MAX
+
+typedef enum {
+    BRACKET_OK,
+    BRACKET_UNEXPECTED_CLOSE,   // chiusa senza nessuna aperta
+    BRACKET_MISMATCH,           // chiusa diversa dall'ultima aperta
+    BRACKET_UNCLOSED,           // alla fine restano parentesi aperte
+    BRACKET_OUT_OF_MEMORY
+} BracketErrorKind;
+
+typedef struct {
+    BracketErrorKind kind;
+    uint64_t offset;        // posizione della parentesi sbagliata (per UNCLOSED: l'ultima aperta)
+    uint64_t openOffset;    // per MISMATCH: posizione dell'aperta; altrimenti BRACKET_NONE
+} BracketError;
+
+// Pila di parentesi con la loro posizione; cresce raddoppiando
+typedef struct {
+    char* type;
+    uint64_t* offset;
+    size_t size;
+    size_t capacity;
+} BracketStack;
+
+typedef struct {
+    BracketStack stack;
+    uint64_t offset;        // byte già ricevuti
+    BracketError error;     // kind == BRACKET_OK finché non si trova un errore
+} BracketChecker;
+
+//------------------------------------------------------------------------------------------
+//=== PILA =================================================================================
+//------------------------------------------------------------------------------------------
+static inline void bracketStackInit(BracketStack* s) {
+    s->type = NULL;
+    s->offset = NULL;
+    s->size = 0;
+    s->capacity = 0;
+}
+
+static inline void bracketStackFree(BracketStack* s) {
+    free(s->type);
+    free(s->offset);
+    bracketStackInit(s);
+}
+
+static inline bool bracketStackPush(BracketStack* s, char c, uint64_t offset) {
+    if (s->size == s->capacity) {
+        size_t capacity = s->capacity ? 2 * s->capacity : 64;
+        char* type = (char*)realloc(s->type, capacity);
+        if (type == NULL) return false;
+        s->type = type;
+        uint64_t* off = (uint64_t*)realloc(s->offset, capacity * sizeof(uint64_t));
+        if (off == NULL) return false;
+        s->offset = off;
+        s->capacity = capacity;
+    }
+    s->type[s->size] = c;
+    s->offset[s->size] = offset;
+    s->size++;
+    return true;
+}
+
+//------------------------------------------------------------------------------------------
+//=== SCANSIONE ============================================================================
+//------------------------------------------------------------------------------------------
+
+// Bit i a 1 se p[i] è una parentesi, per 64 byte
+static inline uint64_t bracketMask64(const char* p) {
+#if defined(__AVX2__)
+    // ( ) differiscono solo nel bit 0; [ { e ] } solo nel bit 5
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+        __m256i round = _mm256_cmpeq_epi8(_mm256_and_si256(v, _mm256_set1_epi8((char)0xFE)), _mm256_set1_epi8('('));
+        __m256i folded = _mm256_and_si256(v, _mm256_set1_epi8((char)0xDF));
+        __m256i square = _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('[')),
+                                         _mm256_cmpeq_epi8(folded, _mm256_set1_epi8(']')));
+        mask |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(round, square)) << i;
+    }
+    return mask;
+#elif defined(__SSE2__)
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i round = _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8((char)0xFE)), _mm_set1_epi8('('));
+        __m128i folded = _mm_and_si128(v, _mm_set1_epi8((char)0xDF));
+        __m128i square = _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('[')),
+                                      _mm_cmpeq_epi8(folded, _mm_set1_epi8(']')));
+        mask |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_or_si128(round, square)) << i;
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i++) {
+        char c = p[i];
+        if (c == '(' || c == ')' || c == '[' || c == ']' || c == '{' || c == '}') mask |= 1ULL << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * Una parentesi c in posizione offset. Se una chiusa non trova aperte sulla
+ * pila: con unmatched == NULL è un errore, altrimenti (parte di un controllo
+ * parallelo) viene messa in unmatched per essere confrontata dopo.
+ */
+static inline bool bracketStep(BracketStack* stack, BracketStack* unmatched, char c, uint64_t offset,
+                               BracketError* error) {
+    char open;
+    if (c == '(' || c == '[' || c == '{') {
+        if (bracketStackPush(stack, c, offset)) return true;
+        error->kind = BRACKET_OUT_OF_MEMORY;
+        error->offset = offset;
+        error->openOffset = BRACKET_NONE;
+        return false;
+    }
+    open = c == ')' ? '(' : c == ']' ? '[' : '{';
+    if (stack->size == 0) {
+        if (unmatched != NULL && bracketStackPush(unmatched, c, offset)) return true;
+        error->kind = unmatched != NULL ? BRACKET_OUT_OF_MEMORY : BRACKET_UNEXPECTED_CLOSE;
+        error->offset = offset;
+        error->openOffset = BRACKET_NONE;
+        return false;
+    }
+    if (stack->type[stack->size - 1] != open) {
+        error->kind = BRACKET_MISMATCH;
+        error->offset = offset;
+        error->openOffset = stack->offset[stack->size - 1];
+        return false;
+    }
+    stack->size--;
+    return true;
+}
+
+// Controlla buf[0..n), che inizia alla posizione base del flusso
+static inline bool bracketScan(BracketStack* stack, BracketStack* unmatched, const char* buf, size_t n,
+                               uint64_t base, BracketError* error) {
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        uint64_t mask = bracketMask64(buf + i);
+        while (mask != 0) {
+            int b = __builtin_ctzll(mask);
+            mask &= mask - 1;
+            if (!bracketStep(stack, unmatched, buf[i + b], base + i + b, error)) return false;
+        }
+    }
+    for (; i < n; i++) {
+        char c = buf[i];
+        if (c == '(' || c == ')' || c == '[' || c == ']' || c == '{' || c == '}') {
+            if (!bracketStep(stack, unmatched, c, base + i, error)) return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------------------
+//=== CONTROLLO SEQUENZIALE ================================================================
+//------------------------------------------------------------------------------------------
+static inline void bracketCheckerInit(BracketChecker* checker) {
+    bracketStackInit(&checker->stack);
+    checker->offset = 0;
+    checker->error.kind = BRACKET_OK;
+    checker->error.offset = BRACKET_NONE;
+    checker->error.openOffset = BRACKET_NONE;
+}
+
+static inline void bracketCheckerFree(BracketChecker* checker) {
+    bracketStackFree(&checker->stack);
+}
+
+// Il pezzo successivo del testo; false dopo il primo errore (i pezzi seguenti vengono ignorati)
+static inline bool bracketCheckerFeed(BracketChecker* checker, const char* buf, size_t n) {
+    if (checker->error.kind != BRACKET_OK) return false;
+    bool ok = bracketScan(&checker->stack, NULL, buf, n, checker->offset, &checker->error);
+    checker->offset += n;
+    return ok;
+}
+
+// Fine del testo: true se tutte le parentesi sono bilanciate
+static inline bool bracketCheckerFinish(BracketChecker* checker) {
+    if (checker->error.kind == BRACKET_OK && checker->stack.size > 0) {
+        checker->error.kind = BRACKET_UNCLOSED;
+        checker->error.offset = checker->stack.offset[checker->stack.size - 1];
+        checker->error.openOffset = BRACKET_NONE;
+    }
+    return checker->error.kind == BRACKET_OK;
+}
+
+//------------------------------------------------------------------------------------------
+//=== CONTROLLO PARALLELO ==================================================================
+//------------------------------------------------------------------------------------------
+#ifdef BRACKET_CHECKER_PARALLEL
+#include <pthread.h>
+
+typedef struct {
+    const char* buf;
+    size_t n;
+    uint64_t base;
+    BracketStack open;          // aperte rimaste aperte alla fine della parte
+    BracketStack unmatched;     // chiuse senza aperta nella parte, in ordine
+    BracketError error;         // primo errore interno alla parte
+    bool ok;
+} BracketChunk;
+
+static inline void* bracketChunkScan(void* arg) {
+    BracketChunk* chunk = (BracketChunk*)arg;
+    chunk->ok = bracketScan(&chunk->open, &chunk->unmatched, chunk->buf, chunk->n, chunk->base, &chunk->error);
+    return NULL;
+}
+
+/**
+ * Come bracketCheckerFeed, con il blocco diviso fra threads thread. Conviene
+ * con blocchi grandi (qualche MB per thread): ogni thread costa la sua
+ * creazione.
+ */
+static inline bool bracketCheckerFeedParallel(BracketChecker* checker, const char* buf, size_t n, int threads) {
+    BracketChunk* chunks;
+    pthread_t* ids;
+    int t, started = 0;
+    if (checker->error.kind != BRACKET_OK) return false;
+    if (threads < 2 || n < (size_t)threads * 64) return bracketCheckerFeed(checker, buf, n);
+    chunks = (BracketChunk*)malloc(threads * sizeof(BracketChunk));
+    ids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    if (chunks == NULL || ids == NULL) {
+        free(chunks);
+        free(ids);
+        return bracketCheckerFeed(checker, buf, n);
+    }
+    for (t = 0; t < threads; t++) {
+        size_t from = n / threads * t, to = t == threads - 1 ? n : n / threads * (t + 1);
+        chunks[t].buf = buf + from;
+        chunks[t].n = to - from;
+        chunks[t].base = checker->offset + from;
+        bracketStackInit(&chunks[t].open);
+        bracketStackInit(&chunks[t].unmatched);
+    }
+    // La prima parte la controlla questo thread
+    for (t = 1; t < threads; t++, started++) {
+        if (pthread_create(&ids[t], NULL, bracketChunkScan, &chunks[t]) != 0) break;
+    }
+    bracketChunkScan(&chunks[0]);
+    for (t = 1 + started; t < threads; t++) bracketChunkScan(&chunks[t]);   // thread non creati
+    for (t = 1; t <= started; t++) pthread_join(ids[t], NULL);
+
+    // Si combinano i riassunti in ordine
+    for (t = 0; t < threads; t++) {
+        BracketChunk* c = &chunks[t];
+        size_t i;
+        if (checker->error.kind == BRACKET_OK) {
+            for (i = 0; i < c->unmatched.size; i++) {
+                if (!bracketStep(&checker->stack, NULL, c->unmatched.type[i], c->unmatched.offset[i],
+                                 &checker->error)) {
+                    break;
+                }
+            }
+        }
+        if (checker->error.kind == BRACKET_OK && !c->ok) checker->error = c->error;
+        for (i = 0; checker->error.kind == BRACKET_OK && i < c->open.size; i++) {
+            if (!bracketStackPush(&checker->stack, c->open.type[i], c->open.offset[i])) {
+                checker->error.kind = BRACKET_OUT_OF_MEMORY;
+                checker->error.offset = c->open.offset[i];
+                checker->error.openOffset = BRACKET_NONE;
+            }
+        }
+        bracketStackFree(&c->open);
+        bracketStackFree(&c->unmatched);
+    }
+    free(chunks);
+    free(ids);
+    checker->offset += n;
+    return checker->error.kind == BRACKET_OK;
+}
+#endif // BRACKET_CHECKER_PARALLEL
+
+#endif
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include "02_c_bracket_checker.h" // BracketChecker: pila che cresce, testo a pezzi, posizione dell'errore
 
 // Define the maximum size for the array-based stack
 #define MAX_SIZE 100
@@ -187,40 +189,87 @@ void freeLinkedStack(LinkedStack* stack) {
 }
 
 // Application: Check if parentheses in an expression are balanced
+// (con BracketChecker la pila cresce quando serve: nessun limite di annidamento)
 bool areParenthesesBalanced(char* expr) {
-    ArrayStack stack;
-    initArrayStack(&stack);
-    
-    for (int i = 0; expr[i] != '\0'; i++) {
-        if (expr[i] == '(' || expr[i] == '[' || expr[i] == '{') {
-            // Push the opening bracket onto the stack
-            arrayStackPush(&stack, expr[i]);
-        } else if (expr[i] == ')' || expr[i] == ']' || expr[i] == '}') {
-            // If the stack is empty, there's no matching opening bracket
-            if (isArrayStackEmpty(&stack)) {
-                return false;
-            }
-            
-            int top;
-            arrayStackPop(&stack, &top);
-            
-            // Check if the popped bracket matches the current closing bracket
-            if ((expr[i] == ')' && top != '(') ||
-                (expr[i] == ']' && top != '[') ||
-                (expr[i] == '}' && top != '{')) {
-                return false;
-            }
-        }
+    BracketChecker checker;
+    bracketCheckerInit(&checker);
+    bracketCheckerFeed(&checker, expr, strlen(expr));
+    bool balanced = bracketCheckerFinish(&checker);
+    bracketCheckerFree(&checker);
+    return balanced;
+}
+
+// Print the result of a bracket check
+void printBracketResult(BracketChecker* checker) {
+    const BracketError* e = &checker->error;
+    switch (e->kind) {
+        case BRACKET_OK:
+            printf("Parentheses are balanced! (%llu bytes)\n", (unsigned long long)checker->offset);
+            break;
+        case BRACKET_UNEXPECTED_CLOSE:
+            printf("Parentheses are NOT balanced: closing bracket without opening one at byte %llu\n",
+                   (unsigned long long)e->offset);
+            break;
+        case BRACKET_MISMATCH:
+            printf("Parentheses are NOT balanced: bracket at byte %llu does not match the one opened at byte %llu\n",
+                   (unsigned long long)e->offset, (unsigned long long)e->openOffset);
+            break;
+        case BRACKET_UNCLOSED:
+            printf("Parentheses are NOT balanced: %llu bracket(s) left open, the last at byte %llu\n",
+                   (unsigned long long)checker->stack.size, (unsigned long long)e->offset);
+            break;
+        case BRACKET_OUT_OF_MEMORY:
+            printf("Out of memory at byte %llu\n", (unsigned long long)e->offset);
+            break;
     }
-    
-    // If the stack is empty, all brackets are matched
-    return isArrayStackEmpty(&stack);
+}
+
+// Check a line from stdin of any length, a piece at a time
+void checkLine(void) {
+    char piece[4096];
+    BracketChecker checker;
+    int c;
+    while ((c = getchar()) == '\n' || c == ' ') {
+        // salta il ritorno a capo lasciato da scanf e gli spazi iniziali
+    }
+    if (c == EOF) return;
+    ungetc(c, stdin);
+    bracketCheckerInit(&checker);
+    while (fgets(piece, sizeof(piece), stdin) != NULL) {
+        size_t n = strlen(piece);
+        bool end = n > 0 && piece[n - 1] == '\n';
+        bracketCheckerFeed(&checker, piece, end ? n - 1 : n);
+        if (end) break;
+    }
+    bracketCheckerFinish(&checker);
+    printBracketResult(&checker);
+    bracketCheckerFree(&checker);
+}
+
+// Check a file of any size, 1 MB at a time
+void checkFile(const char* name) {
+    static char block[1 << 20];
+    FILE* f = fopen(name, "rb");
+    size_t n;
+    if (f == NULL) {
+        printf("Cannot open %s\n", name);
+        return;
+    }
+    BracketChecker checker;
+    bracketCheckerInit(&checker);
+    while ((n = fread(block, 1, sizeof(block), f)) > 0) {
+        if (!bracketCheckerFeed(&checker, block, n)) break;
+    }
+    fclose(f);
+    bracketCheckerFinish(&checker);
+    printBracketResult(&checker);
+    bracketCheckerFree(&checker);
 }
 
 // Main function to demonstrate the stack operations
 int main() {
     int choice, value, result;
-    char expr[100];
+    char fileName[260];
     
     // Array-based stack
     ArrayStack arrayStack;
@@ -242,6 +291,7 @@ int main() {
         printf("\n7. Peek at Linked Stack");
         printf("\n8. Display Linked Stack");
         printf("\n9. Check Parentheses Balance");
+        printf("\n10. Check Parentheses Balance in a file");
         printf("\n0. Exit");
         
         printf("\n\nEnter your choice: ");
@@ -298,11 +348,13 @@ int main() {
                 
             case 9:
                 printf("Enter an expression with parentheses: ");
-                scanf(" %[^\n]", expr);
-                if (areParenthesesBalanced(expr)) {
-                    printf("Parentheses are balanced!\n");
-                } else {
-                    printf("Parentheses are NOT balanced!\n");
+                checkLine();
+                break;
+                
+            case 10:
+                printf("Enter the file name: ");
+                if (scanf(" %259[^\n]", fileName) == 1) {
+                    checkFile(fileName);
                 }
                 break;
                 
@@ -0,0 +1,291 @@
+/** ****************************************************************************************
+* @file 02_cpp_expression.h
+* @brief Valutatore di espressioni aritmetiche: shunting-yard, bytecode in notazione polacca inversa, cache
+*
+* Un'espressione come "x * (y + 2) - 3 ^ 2" viene valutata in due fasi:
+*  1) compile: l'algoritmo shunting-yard di Dijkstra legge il testo una volta
+*     sola, usando una ArrayStack (02_cpp_stack.h) per gli operatori in attesa,
+*     e produce il programma in notazione polacca inversa (RPN)
+*     "x y 2 + * 3 2 ^ -" come bytecode compatto: un byte per istruzione, più
+*     un indice a 16 bit per costanti e variabili. Intanto calcola quanti
+*     operandi al massimo saranno sulla pila durante l'esecuzione;
+*  2) run: un ciclo con uno switch esegue il bytecode su una pila di operandi
+*     già allocata della dimensione giusta, quindi senza controlli di pila
+*     piena o vuota e senza allocazioni.
+* evaluate(testo) tiene i programmi compilati in una cache indicizzata dal
+* testo: se la stessa espressione viene valutata di nuovo (magari con valori
+* diversi delle variabili) si salta la compilazione. Quando la cache arriva a
+* cacheLimit espressioni viene svuotata.
+*
+* Sintassi: numeri decimali (anche 1.5e3), variabili definite prima con
+* setVariable, + - * / % ^ (potenza, associativa a destra), meno e più unari,
+* parentesi tonde. Valori double: la divisione per zero dà inf o nan.
+* Precedenze: ^ poi meno unario poi * / % poi + -, quindi -2^2 vale -4.
+*
+* Uso: #include "02_cpp_expression.h" (vedi 02_cpp_stack.cpp e 02_bench_expression.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <cmath>
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "02_cpp_stack.h" // ArrayStack
+
+// Istruzioni del bytecode
+enum ExpressionOp : uint8_t {
+    OP_CONST,   // seguita dall'indice a 16 bit della costante
+    OP_VAR,     // seguita dall'indice a 16 bit della variabile
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_MOD,
+    OP_POW,
+    OP_NEG,
+    OP_END
+};
+
+// Espressione compilata
+struct ExpressionProgram {
+    std::vector<uint8_t> code;
+    std::vector<double> constants;
+    int maxDepth = 0;   // operandi al massimo sulla pila durante run
+};
+
+class ExpressionEvaluator {
+private:
+    static const int PAREN = 255;   // '(' sulla pila degli operatori
+
+    std::vector<std::string> names;    // variabili: nome e valore con lo stesso indice
+    std::vector<double> values;
+    std::vector<double> operands;      // pila di run, grande quanto il maxDepth più grande
+    std::unordered_map<std::string, ExpressionProgram> cache;
+    size_t cacheLimit;
+    std::string errorMessage;
+    size_t errorPos;
+
+    static int precedence(int op) {
+        switch (op) {
+            case OP_ADD: case OP_SUB: return 1;
+            case OP_MUL: case OP_DIV: case OP_MOD: return 2;
+            case OP_NEG: return 3;
+            case OP_POW: return 4;
+            default: return 0;   // PAREN
+        }
+    }
+
+    static bool rightAssociative(int op) {
+        return op == OP_POW || op == OP_NEG;
+    }
+
+    bool fail(const char* message, size_t pos) {
+        errorMessage = message;
+        errorPos = pos;
+        return false;
+    }
+
+    static void emitIndex(ExpressionProgram& p, uint8_t op, size_t index) {
+        p.code.push_back(op);
+        p.code.push_back((uint8_t)(index & 0xFF));
+        p.code.push_back((uint8_t)(index >> 8));
+    }
+
+    // Emette un operatore tolto dalla pila e aggiorna la profondità della pila di run
+    static void emitOperator(ExpressionProgram& p, int op, int& depth) {
+        p.code.push_back((uint8_t)op);
+        if (op != OP_NEG) depth--;   // gli operatori binari tolgono due operandi e ne mettono uno
+    }
+
+    static void pushOperand(ExpressionProgram& p, int& depth) {
+        if (++depth > p.maxDepth) p.maxDepth = depth;
+    }
+
+    static uint16_t readIndex(const uint8_t* pc) {
+        return (uint16_t)(pc[0] | pc[1] << 8);
+    }
+
+public:
+    // Constructor
+    ExpressionEvaluator(size_t cacheLimit = 100000) : cacheLimit(cacheLimit), errorPos(0) {}
+
+    // Definisce una variabile o ne cambia il valore (le espressioni già compilate restano valide)
+    void setVariable(const std::string& name, double value) {
+        for (size_t i = 0; i < names.size(); i++) {
+            if (names[i] == name) {
+                values[i] = value;
+                return;
+            }
+        }
+        names.push_back(name);
+        values.push_back(value);
+    }
+
+    // Messaggio e posizione (carattere del testo) dell'ultimo errore di compilazione
+    const std::string& error() const {
+        return errorMessage;
+    }
+
+    size_t errorPosition() const {
+        return errorPos;
+    }
+
+    size_t cacheSize() const {
+        return cache.size();
+    }
+
+    void clearCache() {
+        cache.clear();
+    }
+
+    // Traduce text in program; false con error() ed errorPosition() se l'espressione non è valida
+    bool compile(const std::string& text, ExpressionProgram& program) {
+        ArrayStack ops;     // operatori in attesa e parentesi aperte
+        int op, depth = 0;
+        bool expectOperand = true;
+        size_t i = 0, n = text.size();
+        program.code.clear();
+        program.constants.clear();
+        program.maxDepth = 0;
+
+        while (i < n) {
+            char c = text[i];
+            if (c == ' ' || c == '\t') {
+                i++;
+            } else if (expectOperand) {
+                if ((c >= '0' && c <= '9') || c == '.') {
+                    char* end;
+                    double value = strtod(text.c_str() + i, &end);
+                    if (end == text.c_str() + i) return fail("numero non valido", i);
+                    if (program.constants.size() > 0xFFFF) return fail("troppe costanti", i);
+                    emitIndex(program, OP_CONST, program.constants.size());
+                    program.constants.push_back(value);
+                    pushOperand(program, depth);
+                    i = end - text.c_str();
+                    expectOperand = false;
+                } else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_') {
+                    size_t start = i;
+                    while (i < n && (isalnum((unsigned char)text[i]) || text[i] == '_')) i++;
+                    std::string name = text.substr(start, i - start);
+                    size_t v = 0;
+                    while (v < names.size() && names[v] != name) v++;
+                    if (v == names.size()) return fail("variabile non definita", start);
+                    if (v > 0xFFFF) return fail("troppe variabili", start);
+                    emitIndex(program, OP_VAR, v);
+                    pushOperand(program, depth);
+                    expectOperand = false;
+                } else if (c == '(' || c == '-') {
+                    // Parentesi e meno unario non fanno uscire nulla dalla pila
+                    if (ops.isFull()) return fail("espressione troppo annidata", i);
+                    ops.push(c == '(' ? PAREN : OP_NEG);
+                    i++;
+                } else if (c == '+') {
+                    i++;   // più unario: non fa niente
+                } else {
+                    return fail("manca un operando", i);
+                }
+            } else if (c == ')') {
+                while (!ops.isEmpty() && ops.peek(op) && op != PAREN) {
+                    ops.pop(op);
+                    emitOperator(program, op, depth);
+                }
+                if (ops.isEmpty()) return fail("parentesi chiusa senza aperta", i);
+                ops.pop(op);
+                i++;
+            } else {
+                const char* symbols = "+-*/%^";
+                const char* s = c != '\0' ? strchr(symbols, c) : NULL;
+                if (s == NULL) return fail("manca un operatore", i);
+                int current = OP_ADD + (int)(s - symbols);
+                int p = precedence(current);
+                while (!ops.isEmpty() && ops.peek(op) && op != PAREN &&
+                       (precedence(op) > p || (precedence(op) == p && !rightAssociative(current)))) {
+                    ops.pop(op);
+                    emitOperator(program, op, depth);
+                }
+                if (ops.isFull()) return fail("espressione troppo annidata", i);
+                ops.push(current);
+                expectOperand = true;
+                i++;
+            }
+        }
+        if (expectOperand) return fail("espressione incompleta", n);
+        while (!ops.isEmpty()) {
+            ops.pop(op);
+            if (op == PAREN) return fail("parentesi aperta senza chiusa", n);
+            emitOperator(program, op, depth);
+        }
+        program.code.push_back(OP_END);
+        if ((size_t)program.maxDepth > operands.size()) operands.resize(program.maxDepth);
+        return true;
+    }
+
+    // Esegue un programma compilato da questo valutatore con i valori attuali delle variabili
+    double run(const ExpressionProgram& program) {
+        const uint8_t* pc = program.code.data();
+        const double* k = program.constants.data();
+        const double* v = values.data();
+        double* sp = operands.data();   // prima casella libera
+        for (;;) {
+            switch (*pc++) {
+                case OP_CONST: *sp++ = k[readIndex(pc)]; pc += 2; break;
+                case OP_VAR:   *sp++ = v[readIndex(pc)]; pc += 2; break;
+                case OP_ADD:   sp--; sp[-1] += sp[0]; break;
+                case OP_SUB:   sp--; sp[-1] -= sp[0]; break;
+                case OP_MUL:   sp--; sp[-1] *= sp[0]; break;
+                case OP_DIV:   sp--; sp[-1] /= sp[0]; break;
+                case OP_MOD:   sp--; sp[-1] = std::fmod(sp[-1], sp[0]); break;
+                case OP_POW:   sp--; sp[-1] = std::pow(sp[-1], sp[0]); break;
+                case OP_NEG:   sp[-1] = -sp[-1]; break;
+                default:       return sp[-1];   // OP_END
+            }
+        }
+    }
+
+    // Compila text (o lo prende dalla cache) e lo esegue
+    bool evaluate(const std::string& text, double& result) {
+        auto it = cache.find(text);
+        if (it == cache.end()) {
+            ExpressionProgram program;
+            if (!compile(text, program)) return false;
+            if (cache.size() >= cacheLimit) cache.clear();
+            it = cache.emplace(text, std::move(program)).first;
+        }
+        result = run(it->second);
+        return true;
+    }
+
+    // Il programma in notazione polacca inversa, es. "x y 2 + *"
+    std::string toRPN(const ExpressionProgram& program) const {
+        static const char* symbols[] = {"", "", "+", "-", "*", "/", "%", "^", "neg"};
+        std::string out;
+        char number[32];
+        for (const uint8_t* pc = program.code.data(); *pc != OP_END; pc++) {
+            if (!out.empty()) out += ' ';
+            if (*pc == OP_CONST) {
+                snprintf(number, sizeof(number), "%g", program.constants[readIndex(pc + 1)]);
+                out += number;
+                pc += 2;
+            } else if (*pc == OP_VAR) {
+                out += names[readIndex(pc + 1)];
+                pc += 2;
+            } else {
+                out += symbols[*pc];
+            }
+        }
+        return out;
+    }
+};
+
+#endif
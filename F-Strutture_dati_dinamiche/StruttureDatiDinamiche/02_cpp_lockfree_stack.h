@@ -0,0 +1,203 @@
+/** ****************************************************************************************
+* @file 02_cpp_lockfree_stack.h
+* @brief Pila condivisa fra thread senza lock (pila di Treiber) con protezione ABA ed eliminazione
+*
+* LinkedStack (02_cpp_stack.h) si può usare da più thread solo con un mutex
+* attorno ad ogni push e pop, e ogni push alloca un nodo. LockFreeStack:
+*  - i nodi stanno in un array allocato dal costruttore (capacity nodi); i nodi
+*    liberi formano a loro volta una pila senza lock, quindi push e pop non
+*    allocano mai e un nodo non viene mai restituito al sistema: un thread che
+*    legge un nodo appena tolto da un altro legge comunque memoria valida;
+*  - la cima (top) è un intero a 64 bit con l'indice del nodo (32 bit) e un
+*    contatore (32 bit) che aumenta ad ogni modifica: push e pop sono una
+*    compare_exchange su top (algoritmo di Treiber). Problema ABA: un thread
+*    legge top = A con next = B, un altro toglie A e B e rimette A; la
+*    compare_exchange del primo riuscirebbe mettendo in cima B, che non è più
+*    nella pila. Con il contatore top non torna mai uguale a prima (finché il
+*    contatore a 32 bit non fa un giro completo durante una singola operazione);
+*  - eliminazione (se eliminationSlots > 0): quando la compare_exchange
+*    fallisce perché altri thread stanno modificando la cima, invece di
+*    riprovare subito il thread va in una casella a caso di un piccolo array:
+*    un push lascia lì il suo nodo e aspetta un po'; un pop che trova un nodo
+*    offerto se lo prende. Push e pop si annullano a vicenda senza toccare
+*    top, e con molti thread la cima smette di essere il collo di bottiglia.
+* push restituisce false se tutti i capacity nodi sono in uso (come
+* ArrayStack::push quando la pila è piena, ma senza messaggio), pop false se
+* la pila è vuota. size() è esatto solo quando nessun thread sta modificando.
+*
+* Uso: #include "02_cpp_lockfree_stack.h" (vedi 02_bench_lockfree_stack.cpp);
+* compilare con -pthread.
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef LOCKFREE_STACK_H
+#define LOCKFREE_STACK_H
+
+#include <atomic>
+#include <functional>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+class LockFreeStack {
+private:
+    static const uint32_t NIL = 0xFFFFFFFF;   // nessun nodo
+    static const uint64_t EMPTY = 0;          // casella di eliminazione libera
+    static const uint64_t TAKEN = 1;          // nodo offerto preso da un pop
+    static const int SPINS = 64;              // attesa di un push in una casella
+
+    struct Node {
+        int data;
+        std::atomic<uint32_t> next;
+    };
+
+    std::vector<Node> nodes;
+    alignas(64) std::atomic<uint64_t> top;         // contatore << 32 | indice
+    alignas(64) std::atomic<uint64_t> freeList;    // pila dei nodi liberi, stesso formato
+    alignas(64) std::atomic<int> size_;
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> state;               // EMPTY, TAKEN oppure indice del nodo offerto + 2
+    };
+    std::vector<Slot> slots;
+
+    static uint32_t indexOf(uint64_t head) { return (uint32_t)head; }
+
+    static uint64_t tagged(uint64_t old, uint32_t index) {
+        return ((old >> 32) + 1) << 32 | index;
+    }
+
+    // Pila di Treiber generica: top e freeList usano le stesse due funzioni
+    bool tryPush(std::atomic<uint64_t>& head, uint32_t i) {
+        uint64_t old = head.load(std::memory_order_relaxed);
+        nodes[i].next.store(indexOf(old), std::memory_order_relaxed);
+        return head.compare_exchange_weak(old, tagged(old, i), std::memory_order_release,
+                                          std::memory_order_relaxed);
+    }
+
+    // NIL se la pila è vuota, NIL - 1 se la compare_exchange è fallita
+    uint32_t tryPop(std::atomic<uint64_t>& head) {
+        uint64_t old = head.load(std::memory_order_acquire);
+        uint32_t i = indexOf(old);
+        if (i == NIL) return NIL;
+        // next può essere già cambiato se il nodo è stato tolto e riusato da un
+        // altro thread: in quel caso anche il contatore di head è cambiato e la
+        // compare_exchange fallisce
+        uint32_t next = nodes[i].next.load(std::memory_order_relaxed);
+        if (head.compare_exchange_weak(old, tagged(old, next), std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+            return i;
+        }
+        return NIL - 1;
+    }
+
+    void pushLoop(std::atomic<uint64_t>& head, uint32_t i) {
+        while (!tryPush(head, i)) {
+        }
+    }
+
+    uint32_t popLoop(std::atomic<uint64_t>& head) {
+        uint32_t i;
+        while ((i = tryPop(head)) == NIL - 1) {
+        }
+        return i;
+    }
+
+    static uint32_t randomSlot(size_t n) {
+        thread_local uint32_t x = 2463534242u ^ (uint32_t)std::hash<std::thread::id>()(std::this_thread::get_id());
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        return x % n;
+    }
+
+    // Offre il nodo i a un pop: true se un pop l'ha preso
+    bool eliminatePush(uint32_t i) {
+        Slot& s = slots[randomSlot(slots.size())];
+        uint64_t expected = EMPTY;
+        if (!s.state.compare_exchange_strong(expected, i + 2, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+            return false;
+        }
+        for (int k = 0; k < SPINS; k++) {
+            if (s.state.load(std::memory_order_acquire) == TAKEN) {
+                s.state.store(EMPTY, std::memory_order_release);
+                return true;
+            }
+        }
+        // Ritira l'offerta; se non ci riesce un pop l'ha presa proprio adesso
+        expected = i + 2;
+        if (s.state.compare_exchange_strong(expected, EMPTY, std::memory_order_relaxed,
+                                            std::memory_order_relaxed)) {
+            return false;
+        }
+        s.state.store(EMPTY, std::memory_order_release);
+        return true;
+    }
+
+    // Prende un nodo offerto da un push: il suo indice, NIL se non c'è
+    uint32_t eliminatePop() {
+        Slot& s = slots[randomSlot(slots.size())];
+        uint64_t offered = s.state.load(std::memory_order_acquire);
+        if (offered < 2 ||
+            !s.state.compare_exchange_strong(offered, TAKEN, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+            return NIL;
+        }
+        return (uint32_t)(offered - 2);
+    }
+
+public:
+    // Constructor: capacity nodi (al massimo 2^32 - 2), eliminationSlots caselle (0: niente eliminazione)
+    LockFreeStack(uint32_t capacity, int eliminationSlots = 16)
+        : nodes(capacity), top(NIL), freeList(NIL), size_(0), slots(eliminationSlots) {
+        for (uint32_t i = capacity; i-- > 0;) {
+            nodes[i].next.store(indexOf(freeList.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            freeList.store(i, std::memory_order_relaxed);
+        }
+        for (Slot& s : slots) s.state.store(EMPTY, std::memory_order_relaxed);
+    }
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    // Push an element onto the stack
+    bool push(int value) {
+        uint32_t i = popLoop(freeList);
+        if (i == NIL) return false;   // tutti i nodi sono nella pila
+        nodes[i].data = value;
+        while (!tryPush(top, i)) {
+            if (!slots.empty() && eliminatePush(i)) return true;
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Pop an element from the stack
+    bool pop(int& value) {
+        uint32_t i;
+        bool eliminated = false;
+        while ((i = tryPop(top)) == NIL - 1) {
+            if (!slots.empty() && (i = eliminatePop()) != NIL) {
+                eliminated = true;   // il push che l'ha offerto non ha toccato size_
+                break;
+            }
+        }
+        if (i == NIL) return false;
+        value = nodes[i].data;
+        pushLoop(freeList, i);
+        if (!eliminated) size_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool isEmpty() const {
+        return indexOf(top.load(std::memory_order_acquire)) == NIL;
+    }
+
+    int size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+};
+
+#endif
@@ -1,171 +1,7 @@
 #include <iostream>
-#include <memory>
 #include <string>
-
-// Define the maximum size for the array-based stack
-const int MAX_SIZE = 100;
-
-/*
- * Array-based Stack Implementation
- */
-class ArrayStack {
-private:
-    int items[MAX_SIZE];
-    int top;
-    
-public:
-    // Constructor
-    ArrayStack() : top(-1) {}
-    
-    // Check if the stack is empty
-    bool isEmpty() const {
-        return top == -1;
-    }
-    
-    // Check if the stack is full
-    bool isFull() const {
-        return top == MAX_SIZE - 1;
-    }
-    
-    // Push an element onto the stack
-    bool push(int value) {
-        if (isFull()) {
-            std::cout << "Stack Overflow! Cannot push " << value << std::endl;
-            return false;
-        }
-        
-        items[++top] = value;
-        return true;
-    }
-    
-    // Pop an element from the stack
-    bool pop(int& value) {
-        if (isEmpty()) {
-            std::cout << "Stack Underflow! Cannot pop from an empty stack" << std::endl;
-            return false;
-        }
-        
-        value = items[top--];
-        return true;
-    }
-    
-    // Peek at the top element without removing it
-    bool peek(int& value) const {
-        if (isEmpty()) {
-            std::cout << "Stack is empty! Cannot peek" << std::endl;
-            return false;
-        }
-        
-        value = items[top];
-        return true;
-    }
-    
-    // Get the size of the stack
-    int size() const {
-        return top + 1;
-    }
-    
-    // Display the stack
-    void display() const {
-        if (isEmpty()) {
-            std::cout << "Stack is empty!" << std::endl;
-            return;
-        }
-        
-        std::cout << "Stack (top to bottom): ";
-        for (int i = top; i >= 0; i--) {
-            std::cout << items[i] << " ";
-        }
-        std::cout << std::endl;
-    }
-};
-
-/*
- * Linked List-based Stack Implementation
- */
-class LinkedStack {
-private:
-    struct Node {
-        int data;
-        std::shared_ptr<Node> next;
-        
-        // Constructor
-        Node(int val) : data(val), next(nullptr) {}
-    };
-    
-    std::shared_ptr<Node> top;
-    
-public:
-    // Constructor
-    LinkedStack() : top(nullptr) {}
-    
-    // Check if the stack is empty
-    bool isEmpty() const {
-        return top == nullptr;
-    }
-    
-    // Push an element onto the stack
-    bool push(int value) {
-        std::shared_ptr<Node> newNode = std::make_shared<Node>(value);
-        newNode->next = top;
-        top = newNode;
-        return true;
-    }
-    
-    // Pop an element from the stack
-    bool pop(int& value) {
-        if (isEmpty()) {
-            std::cout << "Stack Underflow! Cannot pop from an empty stack" << std::endl;
-            return false;
-        }
-        
-        value = top->data;
-        top = top->next;
-        return true;
-    }
-    
-    // Peek at the top element without removing it
-    bool peek(int& value) const {
-        if (isEmpty()) {
-            std::cout << "Stack is empty! Cannot peek" << std::endl;
-            return false;
-        }
-        
-        value = top->data;
-        return true;
-    }
-    
-    // Get the size of the stack
-    int size() const {
-        int count = 0;
-        std::shared_ptr<Node> current = top;
-        
-        while (current != nullptr) {
-            count++;
-            current = current->next;
-        }
-        
-        return count;
-    }
-    
-    // Display the stack
-    void display() const {
-        if (isEmpty()) {
-            std::cout << "Stack is empty!" << std::endl;
-            return;
-        }
-        
-        std::shared_ptr<Node> current = top;
-        std::cout << "Stack (top to bottom): ";
-        
-        while (current != nullptr) {
-            std::cout << current->data << " ";
-            current = current->next;
-        }
-        
-        std::cout << std::endl;
-    }
-};
+#include "02_cpp_stack.h" // ArrayStack, LinkedStack
+#include "02_cpp_expression.h" // ExpressionEvaluator: shunting-yard, bytecode RPN, cache
 
 // Application: Check if parentheses in an expression are balanced
 bool areParenthesesBalanced(const std::string& expr) {
@@ -227,6 +63,14 @@ int main() {
     // Linked list-based stack
     LinkedStack linkedStack;
     
+    // Expression evaluator with two variables
+    ExpressionEvaluator evaluator;
+    ExpressionProgram program;
+    double result;
+    const double x = 2, y = 10;
+    evaluator.setVariable("x", x);
+    evaluator.setVariable("y", y);
+    
     std::cout << "\n*** Stack Operations (C++) ***" << std::endl;
     
     do {
@@ -240,6 +84,7 @@ int main() {
         std::cout << "\n8. Display Linked Stack";
         std::cout << "\n9. Check Parentheses Balance";
         std::cout << "\n10. Reverse a String";
+        std::cout << "\n11. Evaluate an Expression";
         std::cout << "\n0. Exit";
         
         std::cout << "\n\nEnter your choice: ";
@@ -312,6 +157,20 @@ int main() {
                 std::cout << "Reversed string: " << reverseString(str) << std::endl;
                 break;
                 
+            case 11:
+                std::cout << "Enter an expression (x = " << x << ", y = " << y << "): ";
+                std::cin.ignore(); // Clear the input buffer
+                std::getline(std::cin, expr);
+                if (evaluator.evaluate(expr, result)) {
+                    evaluator.compile(expr, program);
+                    std::cout << "RPN: " << evaluator.toRPN(program) << std::endl;
+                    std::cout << "Result: " << result << std::endl;
+                } else {
+                    std::cout << "Error at position " << evaluator.errorPosition() << ": "
+                              << evaluator.error() << std::endl;
+                }
+                break;
+                
             case 0:
                 std::cout << "Exiting..." << std::endl;
                 break;
@@ -0,0 +1,186 @@
+/** ****************************************************************************************
+* @file 02_cpp_stack.h
+* @brief Pila in C++ su array (ArrayStack) e su lista concatenata (LinkedStack)
+*
+* Le operazioni sono quelle del menu di 02_cpp_stack.cpp. ArrayStack viene
+* usata anche dal compilatore di espressioni in 02_cpp_expression.h per la
+* pila degli operatori.
+*
+* Uso: #include "02_cpp_stack.h" (vedi 02_cpp_stack.cpp e 02_cpp_expression.h)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef STACK_H
+#define STACK_H
+
+#include <iostream>
+#include <memory>
+
+// Define the maximum size for the array-based stack
+const int MAX_SIZE = 100;
+
+/*
+ * Array-based Stack Implementation
+ */
+class ArrayStack {
+private:
+    int items[MAX_SIZE];
+    int top;
+    
+public:
+    // Constructor
+    ArrayStack() : top(-1) {}
+    
+    // Check if the stack is empty
+    bool isEmpty() const {
+        return top == -1;
+    }
+    
+    // Check if the stack is full
+    bool isFull() const {
+        return top == MAX_SIZE - 1;
+    }
+    
+    // Push an element onto the stack
+    bool push(int value) {
+        if (isFull()) {
+            std::cout << "Stack Overflow! Cannot push " << value << std::endl;
+            return false;
+        }
+        
+        items[++top] = value;
+        return true;
+    }
+    
+    // Pop an element from the stack
+    bool pop(int& value) {
+        if (isEmpty()) {
+            std::cout << "Stack Underflow! Cannot pop from an empty stack" << std::endl;
+            return false;
+        }
+        
+        value = items[top--];
+        return true;
+    }
+    
+    // Peek at the top element without removing it
+    bool peek(int& value) const {
+        if (isEmpty()) {
+            std::cout << "Stack is empty! Cannot peek" << std::endl;
+            return false;
+        }
+        
+        value = items[top];
+        return true;
+    }
+    
+    // Get the size of the stack
+    int size() const {
+        return top + 1;
+    }
+    
+    // Display the stack
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "Stack is empty!" << std::endl;
+            return;
+        }
+        
+        std::cout << "Stack (top to bottom): ";
+        for (int i = top; i >= 0; i--) {
+            std::cout << items[i] << " ";
+        }
+        std::cout << std::endl;
+    }
+};
+
+/*
+ * Linked List-based Stack Implementation
+ */
+class LinkedStack {
+private:
+    struct Node {
+        int data;
+        std::shared_ptr<Node> next;
+        
+        // Constructor
+        Node(int val) : data(val), next(nullptr) {}
+    };
+    
+    std::shared_ptr<Node> top;
+    
+public:
+    // Constructor
+    LinkedStack() : top(nullptr) {}
+    
+    // Check if the stack is empty
+    bool isEmpty() const {
+        return top == nullptr;
+    }
+    
+    // Push an element onto the stack
+    bool push(int value) {
+        std::shared_ptr<Node> newNode = std::make_shared<Node>(value);
+        newNode->next = top;
+        top = newNode;
+        return true;
+    }
+    
+    // Pop an element from the stack
+    bool pop(int& value) {
+        if (isEmpty()) {
+            std::cout << "Stack Underflow! Cannot pop from an empty stack" << std::endl;
+            return false;
+        }
+        
+        value = top->data;
+        top = top->next;
+        return true;
+    }
+    
+    // Peek at the top element without removing it
+    bool peek(int& value) const {
+        if (isEmpty()) {
+            std::cout << "Stack is empty! Cannot peek" << std::endl;
+            return false;
+        }
+        
+        value = top->data;
+        return true;
+    }
+    
+    // Get the size of the stack
+    int size() const {
+        int count = 0;
+        std::shared_ptr<Node> current = top;
+        
+        while (current != nullptr) {
+            count++;
+            current = current->next;
+        }
+        
+        return count;
+    }
+    
+    // Display the stack
+    void display() const {
+        if (isEmpty()) {
+            std::cout << "Stack is empty!" << std::endl;
+            return;
+        }
+        
+        std::shared_ptr<Node> current = top;
+        std::cout << "Stack (top to bottom): ";
+        
+        while (current != nullptr) {
+            std::cout << current->data << " ";
+            current = current->next;
+        }
+        
+        std::cout << std::endl;
+    }
+};
+
+#endif
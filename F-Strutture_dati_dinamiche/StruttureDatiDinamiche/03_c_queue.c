@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
 
 // Define the maximum size for the array-based queue
 #define MAX_SIZE 100
@@ -96,11 +97,13 @@ void displaySimpleQueue(SimpleQueue* queue) {
         return;
     }
     
-    printf("Queue (front to rear): ");
+    uscitaTesto("Queue (front to rear): ");
     for (int i = queue->front; i <= queue->rear; i++) {
-        printf("%d ", queue->items[i]);
+        uscitaIntero(queue->items[i]);
+        uscitaCarattere(' ');
     }
-    printf("\n");
+    uscitaCarattere('\n');
+    uscitaSvuota();
 }
 
 /*
@@ -194,17 +197,19 @@ void displayCircularQueue(CircularQueue* queue) {
         return;
     }
     
-    printf("Queue (front to rear): ");
+    uscitaTesto("Queue (front to rear): ");
     int i = queue->front;
     int count = 0;
     
     while (count < queue->size) {
-        printf("%d ", queue->items[i]);
+        uscitaIntero(queue->items[i]);
+        uscitaCarattere(' ');
         i = (i + 1) % MAX_SIZE;
         count++;
     }
     
-    printf("\n");
+    uscitaCarattere('\n');
+    uscitaSvuota();
 }
 
 /*
@@ -313,14 +318,16 @@ void displayLinkedQueue(LinkedQueue* queue) {
     }
     
     Node* current = queue->front;
-    printf("Queue (front to rear): ");
+    uscitaTesto("Queue (front to rear): ");
     
     while (current != NULL) {
-        printf("%d ", current->data);
+        uscitaIntero(current->data);
+        uscitaCarattere(' ');
         current = current->next;
     }
     
-    printf("\n");
+    uscitaCarattere('\n');
+    uscitaSvuota();
 }
 
 // Free the memory allocated for the linked list-based queue
@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <vector>
 #include <iostream>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
 
 using namespace std;
 
@@ -54,29 +55,32 @@ void stampa_coda(pNodo prec)
             n = n + 1;
         }
         // stampo la cornice superiore adattandola al numero di nodi dell coda
-        printf("\t");
+        uscitaTesto("\t");
         for (i = 1; i <= n; i++)
-            printf("-----");
-        printf("\n");
+            uscitaTesto("-----");
+        uscitaTesto("\n");
         // stampo i nodi della coda
-        printf("        Last In ");
-        printf("\n[pCoda]->");
+        uscitaTesto("        Last In ");
+        uscitaTesto("\n[pCoda]->");
         i = 1;
         while (prec != NULL)
         {
-            cout << "[" << prec->info << "]->";
+            uscitaCarattere('[');
+            uscitaIntero(prec->info);
+            uscitaTesto("]->");
             prec = prec->next;
             i = i + 1;
         }
-        printf(" NULL");
-        printf("\n");
+        uscitaTesto(" NULL");
+        uscitaTesto("\n");
         for (i = 1; i < n; i++)
-            printf("     ");
-        printf("  [pTesta]");
-        printf("\n\t");
+            uscitaTesto("     ");
+        uscitaTesto("  [pTesta]");
+        uscitaTesto("\n\t");
         // stampo la cornice inferiore adattandola al numero di nodi della coda
         for (i = 1; i <= n; i++)
-            printf("-----");
+            uscitaTesto("-----");
+        uscitaSvuota(); // una sola scrittura per tutta la coda
     }
     else
         cout << "\n\tLa coda e' vuota!\n\t";
@@ -88,10 +92,13 @@ void stampa_pila(pNodo pila1)
 { // versione iterativa
     while (pila1 != NULL)
     {
-        cout << "\n| " << pila1->info << " |";
+        uscitaTesto("\n| ");
+        uscitaIntero(pila1->info);
+        uscitaTesto(" |");
         pila1 = pila1->next;
     }
-    cout << "\n|____|\n\n";
+    uscitaTesto("\n|____|\n\n");
+    uscitaSvuota();
 }
 
 // prelievo di un nodo dalla Testa  pCoda -> 4 ->3 ->2 ->NUll pTesta
@@ -0,0 +1,118 @@
+/** ****************************************************************************************
+* @file bench_uscita.cpp
+* @brief Tempo per stampare una pila di 10 milioni di elementi con cout, printf e uscita_buffer.h
+*
+* La pila è quella di pila01.cpp (nodo con info e next). Ogni elemento viene
+* stampato come in stampa_pila(): "| valore |" seguito da un a capo, con:
+*  - cout << ... << endl        (una scrittura sul file per ogni riga)
+*  - cout << ... << '\n'
+*  - printf("| %d |\n", ...)
+*  - uscitaTesto/uscitaIntero   (buffer da USCITA_DIM_BUFFER byte, una fwrite per svuotamento)
+* Tutti i metodi devono produrre lo stesso numero di byte.
+*
+* Compilazione ed esecuzione (dalla cartella F-Strutture_dati_dinamiche):
+*   g++ -std=c++17 -O2 comune/bench_uscita.cpp -o bench_uscita
+*   ./bench_uscita [file di uscita, default /dev/null] [numero di elementi]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <chrono>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include "uscita_buffer.h"
+
+using namespace std;
+
+struct s_nodo
+{
+    int info;
+    s_nodo *next;
+};
+typedef struct s_nodo nodo;
+typedef nodo *pNodo;
+
+static void stampaEndl(pNodo p)
+{
+    for (; p != NULL; p = p->next)
+        cout << "| " << p->info << " |" << endl;
+}
+
+static void stampaCout(pNodo p)
+{
+    for (; p != NULL; p = p->next)
+        cout << "| " << p->info << " |" << '\n';
+    cout.flush();
+}
+
+static void stampaPrintf(pNodo p)
+{
+    for (; p != NULL; p = p->next)
+        printf("| %d |\n", p->info);
+    fflush(stdout);
+}
+
+static void stampaBuffer(pNodo p)
+{
+    for (; p != NULL; p = p->next)
+    {
+        uscitaTesto("| ");
+        uscitaIntero(p->info);
+        uscitaTesto(" |\n");
+    }
+    uscitaSvuota();
+}
+
+int main(int argc, char *argv[])
+{
+    const char *file = argc > 1 ? argv[1] : "/dev/null";
+    long quanti = argc > 2 ? atol(argv[2]) : 10000000;
+    if (freopen(file, "w", stdout) == NULL)
+    {
+        fprintf(stderr, "impossibile aprire %s\n", file);
+        return 1;
+    }
+
+    // Nodi allocati in un unico blocco: si misura la stampa, non la memoria
+    nodo *nodi = new nodo[quanti];
+    srand(1);
+    for (long i = 0; i < quanti; i++)
+    {
+        nodi[i].info = rand() % 2000000 - 1000000;
+        nodi[i].next = i + 1 < quanti ? &nodi[i + 1] : NULL;
+    }
+
+    struct
+    {
+        const char *nome;
+        void (*stampa)(pNodo);
+    } metodi[] = {
+        {"cout << endl", stampaEndl},
+        {"cout << '\\n'", stampaCout},
+        {"printf", stampaPrintf},
+        {"uscita_buffer.h", stampaBuffer},
+    };
+
+    fprintf(stderr, "%ld elementi su %s\n", quanti, file);
+    fprintf(stderr, "metodo            secondi    ns/elemento   MB scritti\n");
+    long riferimento = -1;
+    bool ok = true;
+    for (auto &m : metodi)
+    {
+        long inizio = ftell(stdout);
+        auto t0 = chrono::steady_clock::now();
+        m.stampa(nodi);
+        chrono::duration<double> t = chrono::steady_clock::now() - t0;
+        long byte = ftell(stdout) - inizio;
+        if (riferimento < 0)
+            riferimento = byte;
+        ok = ok && (byte == riferimento || byte <= 0);   // /dev/null non conta i byte
+        fprintf(stderr, "%-16s %8.3f   %12.1f   %10.1f\n", m.nome, t.count(), t.count() / quanti * 1e9, byte / 1e6);
+    }
+    delete[] nodi;
+    if (!ok)
+        fprintf(stderr, "ERRORE: i metodi hanno scritto quantità diverse\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/** ****************************************************************************************
+* @file uscita_buffer.h
+* @brief Uscita formattata con buffer, per stampare velocemente strutture grandi
+*
+* Stampare una lista con un printf() o un cout << ... << endl per ogni elemento
+* costa una chiamata di libreria per elemento (e con endl anche una scrittura
+* sul terminale per riga). Queste funzioni invece scrivono testo e numeri in un
+* unico buffer grande (USCITA_DIM_BUFFER byte) e lo passano a stdout con una
+* sola fwrite quando è pieno o quando si chiama uscitaSvuota().
+*
+* I numeri sono convertiti con std::to_chars in C++17 e con una conversione
+* scritta a mano in C (e nel C++ precedente): lo stesso file si include sia
+* dai programmi .c che .cpp.
+*
+* Regola d'uso: chiamare uscitaSvuota() alla fine di ogni funzione di
+* visualizzazione, prima di usare di nuovo printf() o cout, per mantenere
+* l'ordine delle stampe.
+*
+* Esempio:
+*   for (p = testa; p != NULL; p = p->next) {
+*       uscitaIntero(p->info);
+*       uscitaTesto(" -> ");
+*   }
+*   uscitaTesto("NULL\n");
+*   uscitaSvuota();
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef USCITA_BUFFER_H
+#define USCITA_BUFFER_H
+
+#include <stdio.h>
+#include <string.h>
+#if defined(__cplusplus) && __cplusplus >= 201703L
+#define USCITA_TO_CHARS
+#include <charconv>
+#endif
+
+#ifndef USCITA_DIM_BUFFER
+#define USCITA_DIM_BUFFER (1 << 16)
+#endif
+
+// Spazio sempre disponibile prima di scrivere un numero
+#define USCITA_MAX_NUMERO 64
+
+static char uscita_buffer[USCITA_DIM_BUFFER];
+static size_t uscita_n = 0;
+
+// Scrive il contenuto del buffer su stdout con una sola fwrite
+static inline void uscitaSvuota(void)
+{
+    if (uscita_n > 0)
+    {
+        fwrite(uscita_buffer, 1, uscita_n, stdout);
+        uscita_n = 0;
+    }
+    fflush(stdout);
+}
+
+static inline void uscitaSpazio(size_t n)
+{
+    if (uscita_n + n > USCITA_DIM_BUFFER)
+    {
+        fwrite(uscita_buffer, 1, uscita_n, stdout);
+        uscita_n = 0;
+    }
+}
+
+static inline void uscitaDati(const char *s, size_t n)
+{
+    if (n > USCITA_DIM_BUFFER)
+    { // testo più grande del buffer: lo si scrive direttamente
+        uscitaSpazio(USCITA_DIM_BUFFER);
+        fwrite(s, 1, n, stdout);
+        return;
+    }
+    uscitaSpazio(n);
+    memcpy(uscita_buffer + uscita_n, s, n);
+    uscita_n += n;
+}
+
+static inline void uscitaTesto(const char *s)
+{
+    uscitaDati(s, strlen(s));
+}
+
+static inline void uscitaCarattere(char c)
+{
+    uscitaSpazio(1);
+    uscita_buffer[uscita_n++] = c;
+}
+
+// Intero allineato a destra in almeno larghezza caratteri, come printf("%*d")
+static inline void uscitaInteroLargo(long long valore, int larghezza)
+{
+    char cifre[24];
+    char *fine = cifre + sizeof(cifre);
+    char *inizio;
+    size_t n;
+    int spazi;
+#ifdef USCITA_TO_CHARS
+    inizio = cifre;
+    fine = std::to_chars(cifre, fine, valore).ptr;
+#else
+    unsigned long long u = valore < 0 ? 0ULL - (unsigned long long)valore : (unsigned long long)valore;
+    inizio = fine;
+    do
+    {
+        *--inizio = (char)('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    if (valore < 0)
+        *--inizio = '-';
+#endif
+    n = (size_t)(fine - inizio);
+    spazi = larghezza > (int)n ? larghezza - (int)n : 0;
+    uscitaSpazio(USCITA_MAX_NUMERO + (size_t)spazi);
+    while (spazi-- > 0)
+        uscita_buffer[uscita_n++] = ' ';
+    memcpy(uscita_buffer + uscita_n, inizio, n);
+    uscita_n += n;
+}
+
+static inline void uscitaIntero(long long valore)
+{
+    uscitaInteroLargo(valore, 0);
+}
+
+// Numero con cifre decimali fisse, come printf("%.*f")
+static inline void uscitaDecimale(double valore, int cifre)
+{
+    uscitaSpazio(USCITA_MAX_NUMERO);
+#ifdef USCITA_TO_CHARS
+    std::to_chars_result r = std::to_chars(uscita_buffer + uscita_n, uscita_buffer + uscita_n + USCITA_MAX_NUMERO,
+                                           valore, std::chars_format::fixed, cifre);
+    if (r.ec == std::errc())
+    {
+        uscita_n = (size_t)(r.ptr - uscita_buffer);
+        return;
+    }
+#endif
+    {
+        int n = snprintf(uscita_buffer + uscita_n, USCITA_MAX_NUMERO, "%.*f", cifre, valore);
+        if (n > 0)
+            uscita_n += n < USCITA_MAX_NUMERO ? (size_t)n : USCITA_MAX_NUMERO - 1;
+    }
+}
+
+#endif
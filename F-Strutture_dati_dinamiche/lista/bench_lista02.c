@@ -0,0 +1,225 @@
+/** ****************************************************************************************
+* @file bench_lista02.c
+* @brief Tempo di ogni operazione di lista02.h con allocatoreMalloc e con un'ArenaNodi
+*
+* 1) Verifica: 200000 operazioni casuali confrontate con un array, con
+*    entrambi gli allocatori (anche dopo un liberaLista, quando l'arena riusa
+*    i suoi nodi); intanto una seconda lista costruita con lo stesso
+*    allocatore non deve cambiare.
+* 2) ns per operazione:
+*    - inserisciInTesta, eliminaTesta, liberaLista, visualizzaLista su N elementi;
+*    - svuotaArena (solo con l'arena) su N elementi;
+*    - cercaNodo di valori casuali su N elementi (anche in ns per nodo esaminato);
+*    - inserisciInCoda, inserisciInPosizione ed eliminaNodo (O(n) ciascuna)
+*      su una lista di N / 100 elementi (al massimo 10000).
+*
+* I risultati vanno su stderr, le liste stampate da visualizzaLista su stdout:
+*   gcc -std=c99 -O2 bench_lista02.c lista02.c -o bench_lista02
+*   ./bench_lista02 [N, default 1000000] > /dev/null        (Windows: > NUL)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "lista02.h"
+
+static double secondi(clock_t inizio) {
+    return (double)(clock() - inizio) / CLOCKS_PER_SEC;
+}
+
+// Generatore xorshift: più veloce di rand() e con 32 bit casuali anche su Windows
+static unsigned int seme = 2463534242u;
+
+static unsigned int casuale(void) {
+    seme ^= seme << 13;
+    seme ^= seme >> 17;
+    seme ^= seme << 5;
+    return seme;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+#define MAX_VERIFICA 4000
+
+static int verifica(void) {
+    static int rif[MAX_VERIFICA];   // contenuto atteso
+    int n = 0, op, i;
+    Nodo* lista = NULL;
+    Nodo* altra = NULL;   // non va toccata dalle operazioni su lista
+    for (i = 0; i < 1000; i++) altra = inserisciInTesta(altra, -i);
+    for (op = 0; op < 200000; op++) {
+        int tipo = casuale() % 8, valore = casuale() % 500;
+        if (op == 100000) {
+            liberaLista(lista);
+            lista = NULL;
+            n = 0;
+        }
+        if (n >= MAX_VERIFICA - 1) {
+            tipo = 5;   // lista piena: si toglie la testa
+        }
+        if (tipo == 0 || (tipo < 5 && n == 0)) {
+            lista = inserisciInTesta(lista, valore);
+            for (i = n; i > 0; i--) rif[i] = rif[i - 1];
+            rif[0] = valore;
+            n++;
+        } else if (tipo == 1) {
+            lista = inserisciInCoda(lista, valore);
+            rif[n++] = valore;
+        } else if (tipo <= 3) {
+            int pos = casuale() % (n + 1);
+            lista = inserisciInPosizione(lista, valore, pos);
+            for (i = n; i > pos; i--) rif[i] = rif[i - 1];
+            rif[pos] = valore;
+            n++;
+        } else if (tipo == 4) {
+            Nodo* trovato = cercaNodo(lista, valore);
+            for (i = 0; i < n && rif[i] != valore; i++) {
+            }
+            if ((trovato == NULL) != (i == n) || (trovato != NULL && trovato->valore != valore)) return 0;
+        } else if (tipo == 5) {
+            lista = eliminaTesta(lista);
+            if (n > 0) {
+                for (i = 1; i < n; i++) rif[i - 1] = rif[i];
+                n--;
+            }
+        } else {
+            lista = eliminaNodo(lista, valore);
+            for (i = 0; i < n && rif[i] != valore; i++) {
+            }
+            if (i < n) {
+                for (i++; i < n; i++) rif[i - 1] = rif[i];
+                n--;
+            }
+        }
+    }
+    {
+        Nodo* p = lista;
+        for (i = 0; i < n; i++, p = p->next) {
+            if (p == NULL || p->valore != rif[i]) return 0;
+        }
+        if (p != NULL) return 0;
+        for (i = 999, p = altra; i >= 0; i--, p = p->next) {
+            if (p == NULL || p->valore != -i) return 0;
+        }
+        if (p != NULL) return 0;
+    }
+    liberaLista(lista);
+    liberaLista(altra);
+    return 1;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+enum { TESTA, CERCA, CERCA_NODO, CODA, POSIZIONE, ELIMINA_NODO, ELIMINA_TESTA, VISUALIZZA, LIBERA, SVUOTA, OPERAZIONI };
+
+static const char* nomi[OPERAZIONI] = {
+    "inserisciInTesta", "cercaNodo", "  (per nodo esaminato)", "inserisciInCoda", "inserisciInPosizione",
+    "eliminaNodo", "eliminaTesta", "visualizzaLista", "liberaLista", "svuotaArena",
+};
+
+// Elementi della lista per le operazioni O(n)
+static int piccola(int n) {
+    return n / 100 < 10000 ? n / 100 : 10000;
+}
+
+// ns per operazione con l'allocatore in uso (arena: quella in uso, NULL con malloc)
+static void misura(int n, double* ns, ArenaNodi* arena) {
+    const int m = piccola(n);
+    const int ricerche = 20;
+    Nodo* lista = NULL;
+    clock_t inizio;
+    long long esaminati = 0;
+    int i;
+
+    // Lista di n elementi: in testa c'è n - 1, il valore v è in posizione n - 1 - v
+    inizio = clock();
+    for (i = 0; i < n; i++) lista = inserisciInTesta(lista, i);
+    ns[TESTA] = secondi(inizio) / n * 1e9;
+
+    inizio = clock();
+    for (i = 0; i < ricerche; i++) {
+        int v = casuale() % n;
+        if (cercaNodo(lista, v) == NULL) {
+            fprintf(stderr, "ERRORE: cercaNodo(%d) non trova il valore\n", v);
+            exit(1);
+        }
+        esaminati += n - v;
+    }
+    ns[CERCA] = secondi(inizio) / ricerche * 1e9;
+    ns[CERCA_NODO] = ns[CERCA] * ricerche / esaminati;
+
+    inizio = clock();
+    visualizzaLista(lista);
+    ns[VISUALIZZA] = secondi(inizio) / n * 1e9;
+
+    inizio = clock();
+    liberaLista(lista);
+    ns[LIBERA] = secondi(inizio) / n * 1e9;
+
+    ns[SVUOTA] = -1;
+    if (arena != NULL) {
+        lista = NULL;
+        for (i = 0; i < n; i++) lista = inserisciInTesta(lista, i);
+        inizio = clock();
+        svuotaArena(arena);
+        ns[SVUOTA] = secondi(inizio) / n * 1e9;
+    }
+
+    lista = NULL;
+    for (i = 0; i < n; i++) lista = inserisciInTesta(lista, i);
+    inizio = clock();
+    for (i = 0; i < n; i++) lista = eliminaTesta(lista);
+    ns[ELIMINA_TESTA] = secondi(inizio) / n * 1e9;
+
+    // Operazioni O(n) su una lista più piccola
+    inizio = clock();
+    for (i = 0; i < m; i++) lista = inserisciInCoda(lista, i);
+    ns[CODA] = secondi(inizio) / m * 1e9;
+
+    inizio = clock();
+    for (i = 0; i < m; i++) lista = inserisciInPosizione(lista, m + i, casuale() % (m + i));
+    ns[POSIZIONE] = secondi(inizio) / m * 1e9;
+
+    inizio = clock();
+    for (i = 0; i < m; i++) lista = eliminaNodo(lista, casuale() % (2 * m));
+    ns[ELIMINA_NODO] = secondi(inizio) / m * 1e9;
+
+    liberaLista(lista);
+}
+
+int main(int argc, char* argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    ArenaNodi arena;
+    double conMalloc[OPERAZIONI], conArena[OPERAZIONI];
+    int ok, i;
+    if (n < 100) n = 100;
+
+    inizializzaArena(&arena);
+    ok = verifica();
+    usaAllocatore(&arena.base);
+    ok = ok && verifica();
+    usaAllocatore(&allocatoreMalloc);
+    fprintf(stderr, "Verifica: %s\n\n", ok ? "risultati uguali all'array" : "ERRORE");
+
+    misura(n, conMalloc, NULL);
+    usaAllocatore(&arena.base);
+    misura(n, conArena, &arena);
+    usaAllocatore(&allocatoreMalloc);
+    distruggiArena(&arena);
+
+    fprintf(stderr, "ns per operazione, N = %d (operazioni O(n) su %d elementi)\n", n, piccola(n));
+    fprintf(stderr, "%-24s %10s %10s\n", "operazione", "malloc", "arena");
+    for (i = 0; i < OPERAZIONI; i++) {
+        if (conMalloc[i] < 0) {
+            fprintf(stderr, "%-24s %10s %10.1f\n", nomi[i], "-", conArena[i]);
+        } else {
+            fprintf(stderr, "%-24s %10.1f %10.1f\n", nomi[i], conMalloc[i], conArena[i]);
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/** ****************************************************************************************
+* @file bench_visita_lista.cpp
+* @brief Ricerca e somma su 10M nodi: ricorsione, ciclo di lista01.cpp e visitaLista
+*
+* Le varianti confrontate (in ns per nodo, cercando un valore che non c'è,
+* quindi visitando tutta la lista):
+*  - cerca_eleR ricorsiva, com'era in lista01.cpp: a -O0 con 10M nodi
+*    servirebbero centinaia di MB di stack, quindi viene eseguita solo se il
+*    programma è compilato con le ottimizzazioni (che la trasformano in un
+*    ciclo) e altrimenti su una lista di 10000 nodi;
+*  - cerca_ele iterativa, com'era in lista01.cpp (ciclo con flag);
+*  - visitaLista senza prefetch (ciclo semplice con uscita anticipata);
+*  - visitaLista di visita_lista.h (con prefetch di next->next);
+*  - somma degli elementi con perOgniNodo.
+* Le liste hanno i nodi in memoria nell'ordine della lista e in ordine casuale.
+*
+* Compilazione ed esecuzione (da provare con entrambi i livelli di ottimizzazione):
+*   g++ -std=c++17 -O0 bench_visita_lista.cpp -o bench_visita_O0 && ./bench_visita_O0
+*   g++ -std=c++17 -O2 bench_visita_lista.cpp -o bench_visita_O2 && ./bench_visita_O2
+*   [argomento: numero di nodi, default 10000000]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "visita_lista.h"
+
+struct s_nodo
+{
+    int info;
+    s_nodo *next;
+};
+typedef struct s_nodo nodo;
+typedef nodo *pNodo;
+
+// Le due versioni originali di lista01.cpp
+bool cerca_eleR(pNodo p, int e)
+{
+    if (p == NULL)
+        return (false);
+    else if (p->info == e)
+        return (true);
+    else
+        return (cerca_eleR(p->next, e));
+}
+
+bool cerca_ele(pNodo p, int e)
+{
+    bool f = false;
+    while ((p != NULL) && (!f))
+    {
+        if (p->info == e)
+            f = true;
+        else
+            p = p->next;
+    }
+    return (f);
+}
+
+// visitaLista senza prefetch, per misurare quanto guadagna
+template <typename Visitatore>
+pNodo visitaSemplice(pNodo p, Visitatore visita)
+{
+    for (; p != NULL; p = p->next)
+        if (visita(p))
+            return (p);
+    return (NULL);
+}
+
+static double secondi(std::chrono::steady_clock::time_point inizio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inizio).count();
+}
+
+// ns per nodo di una visita completa (la più veloce di 3)
+template <typename Visita>
+static double tempo(int n, Visita visita)
+{
+    double migliore = 1e30;
+    for (int r = 0; r < 3; r++)
+    {
+        auto inizio = std::chrono::steady_clock::now();
+        if (visita())
+        {
+            printf("ERRORE: valore trovato\n");
+            exit(1);
+        }
+        migliore = std::min(migliore, secondi(inizio));
+    }
+    return migliore / n * 1e9;
+}
+
+// Lista di n nodi in un array, collegati in ordine o in ordine casuale, con info = 0..n-1
+static pNodo costruisci(std::vector<nodo> &nodi, bool sparsi, std::mt19937 &gen)
+{
+    int n = (int)nodi.size();
+    std::vector<int> ordine(n);
+    std::iota(ordine.begin(), ordine.end(), 0);
+    if (sparsi)
+        std::shuffle(ordine.begin(), ordine.end(), gen);
+    for (int i = 0; i < n; i++)
+    {
+        nodi[ordine[i]].info = i;
+        nodi[ordine[i]].next = i + 1 < n ? &nodi[ordine[i + 1]] : NULL;
+    }
+    return &nodi[ordine[0]];
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+#ifdef __OPTIMIZE__
+    const bool ottimizzato = true;
+#else
+    const bool ottimizzato = false;
+#endif
+    const int nRicorsiva = ottimizzato ? n : std::min(n, 10000);
+    const int assente = -1;
+    std::mt19937 gen(42);
+
+    printf("ns per nodo, %d nodi (%s)\n", n, ottimizzato ? "con ottimizzazioni" : "senza ottimizzazioni, -O0");
+    printf("%-38s %10s %10s\n", "variante", "in ordine", "sparsi");
+    double t[5][2];
+    for (int sparsi = 0; sparsi < 2; sparsi++)
+    {
+        std::vector<nodo> nodi(n);
+        pNodo testa = costruisci(nodi, sparsi, gen);
+
+        std::vector<nodo> piccola(nRicorsiva);
+        pNodo testaPiccola = nRicorsiva == n ? testa : costruisci(piccola, sparsi, gen);
+        t[0][sparsi] = tempo(nRicorsiva, [&]
+                             { return cerca_eleR(testaPiccola, assente); });
+
+        t[1][sparsi] = tempo(n, [&]
+                             { return cerca_ele(testa, assente); });
+        t[2][sparsi] = tempo(n, [&]
+                             { return visitaSemplice(testa, [](pNodo q)
+                                                     { return q->info == assente; }) != NULL; });
+        t[3][sparsi] = tempo(n, [&]
+                             { return visitaLista(testa, [](pNodo q)
+                                                  { return q->info == assente; }) != NULL; });
+        t[4][sparsi] = tempo(n, [&]
+                             {
+            long long somma = 0;
+            perOgniNodo(testa, [&](pNodo q) { somma += q->info; });
+            return somma != (long long)n * (n - 1) / 2; });
+    }
+
+    char ricorsiva[64];
+    snprintf(ricorsiva, sizeof(ricorsiva), "cerca_eleR ricorsiva (%d nodi)", nRicorsiva);
+    const char *nomi[5] = {ricorsiva, "cerca_ele (ciclo con flag)", "visitaLista senza prefetch",
+                           "visitaLista", "somma con perOgniNodo"};
+    for (int v = 0; v < 5; v++)
+        printf("%-38s %10.2f %10.2f\n", nomi[v], t[v][0], t[v][1]);
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <vector>
 #include <iostream>
+#include "visita_lista.h" // visitaLista, perOgniNodo
 
 using namespace std;
 
@@ -15,66 +16,34 @@ typedef nodo *pNodo;
 
 // visualizzazione della lista
 void stampa_lista(pNodo p)
-{ // versione iterativa
-    while (p != NULL)
-    {
-        cout << "[" << p->info << "]->";
-        p = p->next;
-    }
+{ // versione iterativa, con visitaLista (vedi visita_lista.h)
+    perOgniNodo(p, [](pNodo q)
+                { cout << "[" << q->info << "]->"; });
     cout << "NULL \n\n";
 }
 
 void stampa_listaR(pNodo p)
-{ // versione ricorsiva
-    if (p != NULL)
-    {
-        cout << "[" << p->info << "]->";
-        // cout << p->val ;
-        stampa_listaR(p->next);
-    }
-    else
-        cout << "NULL \n\n";
-
-} // è tail recursive
+{ // era la versione ricorsiva: una chiamata per nodo, stack overflow
+  // con liste lunghe se il compilatore non la trasforma in un ciclo
+    stampa_lista(p);
+}
 
 // ricerca di un elemento nella lista
-bool cerca_eleR(pNodo p, int e)
-{ // versione ricorsiva
-    if (p == NULL)
-        return (false);
-    else if (p->info == e)
-        return (true);
-    else
-        return (cerca_eleR(p->next, e));
-} // è tail recursive
-
 bool cerca_ele(pNodo p, int e)
-{ // versione iterativa
-    bool f = false;
-    while ((p != NULL) && (!f))
-    {
-        if (p->info == e)
-            f = true;
-        else
-            p = p->next;
-    }
-    return (f);
+{ // versione iterativa: visitaLista si ferma al primo nodo che contiene e
+    return (visitaLista(p, [e](pNodo q)
+                        { return q->info == e; }) != NULL);
+}
+
+bool cerca_eleR(pNodo p, int e)
+{ // era la versione ricorsiva (vedi stampa_listaR)
+    return (cerca_ele(p, e));
 }
 
 pNodo trova_pos_ele(pNodo p, int e)
-{               // versione iterativa
-    pNodo prec; // serve se non viene trovato
-    while (p != NULL)
-    {
-        if (p->info == e)
-            return (p);
-        else
-        {
-            prec = p; // lo salvo nel caso finisse la lista
-            p = p->next;
-        }
-    }
-    return (prec); // ultimo elemento
+{ // versione iterativa: se e non c'è ci si ferma sull'ultimo elemento
+    return (visitaLista(p, [e](pNodo q)
+                        { return q->info == e || q->next == NULL; }));
 }
 
 int main()
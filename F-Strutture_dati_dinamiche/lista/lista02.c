@@ -0,0 +1,217 @@
+/** ****************************************************************************************
+* @file lista02.c
+* @brief Implementazione delle liste concatenate di lista02.h e degli allocatori dei nodi
+*
+* L'allocatore in uso (allocatoreNodi) è una sola variabile per tutto il
+* programma: una lista costruita in un file .c si può liberare da un altro.
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include "lista02.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
+
+//------------------------------------------------------------------------------------------
+//=== ALLOCATORI DEI NODI ==================================================================
+//------------------------------------------------------------------------------------------
+
+static Nodo* prendiMalloc(Allocatore* a) {
+    (void)a;
+    return (Nodo*)malloc(sizeof(Nodo));
+}
+
+static void restituisciMalloc(Allocatore* a, Nodo* nodo) {
+    (void)a;
+    free(nodo);
+}
+
+Allocatore allocatoreMalloc = {prendiMalloc, restituisciMalloc};
+
+#define NODI_PER_BLOCCO 4096
+
+typedef struct BloccoArena {
+    struct BloccoArena* next;
+    Nodo nodi[NODI_PER_BLOCCO];
+} BloccoArena;
+
+static Nodo* prendiArena(Allocatore* a) {
+    ArenaNodi* arena = (ArenaNodi*)a;
+    Nodo* nodo = arena->liberi;
+    if (nodo != NULL) {
+        arena->liberi = nodo->next;
+        return nodo;
+    }
+    if (arena->corrente == NULL || arena->usati == NODI_PER_BLOCCO) {
+        // Blocco successivo: già allocato (dopo uno svuotaArena) o nuovo
+        BloccoArena* blocco = arena->corrente != NULL ? arena->corrente->next : arena->blocchi;
+        if (blocco == NULL) {
+            blocco = (BloccoArena*)malloc(sizeof(BloccoArena));
+            if (blocco == NULL) {
+                return NULL;
+            }
+            blocco->next = NULL;
+            if (arena->corrente != NULL) {
+                arena->corrente->next = blocco;
+            } else {
+                arena->blocchi = blocco;
+            }
+        }
+        arena->corrente = blocco;
+        arena->usati = 0;
+    }
+    return &arena->corrente->nodi[arena->usati++];
+}
+
+static void restituisciArena(Allocatore* a, Nodo* nodo) {
+    ArenaNodi* arena = (ArenaNodi*)a;
+    nodo->next = arena->liberi;
+    arena->liberi = nodo;
+}
+
+void inizializzaArena(ArenaNodi* arena) {
+    arena->base.prendi = prendiArena;
+    arena->base.restituisci = restituisciArena;
+    arena->blocchi = NULL;
+    arena->corrente = NULL;
+    arena->usati = 0;
+    arena->liberi = NULL;
+}
+
+// Si ricomincia dal primo blocco, senza liberare la memoria
+void svuotaArena(ArenaNodi* arena) {
+    arena->corrente = NULL;
+    arena->usati = 0;
+    arena->liberi = NULL;
+}
+
+void distruggiArena(ArenaNodi* arena) {
+    BloccoArena* blocco = arena->blocchi;
+    while (blocco != NULL) {
+        BloccoArena* next = blocco->next;
+        free(blocco);
+        blocco = next;
+    }
+    inizializzaArena(arena);
+}
+
+static Allocatore* allocatoreNodi = &allocatoreMalloc;
+
+void usaAllocatore(Allocatore* a) {
+    allocatoreNodi = a;
+}
+
+//------------------------------------------------------------------------------------------
+//=== OPERAZIONI SULLA LISTA ===============================================================
+//------------------------------------------------------------------------------------------
+
+// Crea un nuovo nodo (non collegato)
+Nodo* creaNodo(int valore) {
+    Nodo* nuovo = allocatoreNodi->prendi(allocatoreNodi);
+    if (nuovo == NULL) {
+        printf("Errore di allocazione della memoria!\n");
+        exit(1);
+    }
+    nuovo->valore = valore;
+    nuovo->next = NULL;
+    return nuovo;
+}
+
+// Inserisce in testa: il nuovo nodo diventa la testa
+Nodo* inserisciInTesta(Nodo* testa, int valore) {
+    Nodo* nuovo = creaNodo(valore);
+    nuovo->next = testa;
+    return nuovo;
+}
+
+// Inserisce in coda (percorre tutta la lista: O(n))
+Nodo* inserisciInCoda(Nodo* testa, int valore) {
+    Nodo* nuovo = creaNodo(valore);
+    Nodo* corrente;
+    if (testa == NULL) {
+        return nuovo;
+    }
+    corrente = testa;
+    while (corrente->next != NULL) {
+        corrente = corrente->next;
+    }
+    corrente->next = nuovo;
+    return testa;
+}
+
+// Inserisce in modo che il nuovo nodo sia in posizione posizione (0 = testa)
+Nodo* inserisciInPosizione(Nodo* testa, int valore, int posizione) {
+    Nodo* corrente = testa;
+    Nodo* nuovo;
+    int i;
+    if (posizione == 0) {
+        return inserisciInTesta(testa, valore);
+    }
+    // Ci si ferma sul nodo in posizione - 1
+    for (i = 0; corrente != NULL && i < posizione - 1; i++) {
+        corrente = corrente->next;
+    }
+    if (posizione < 0 || corrente == NULL) {
+        printf("Posizione non valida!\n");
+        return testa;
+    }
+    nuovo = creaNodo(valore);
+    nuovo->next = corrente->next;
+    corrente->next = nuovo;
+    return testa;
+}
+
+// Elimina il primo nodo; restituisce la nuova testa
+Nodo* eliminaTesta(Nodo* testa) {
+    Nodo* next;
+    if (testa == NULL) {
+        return NULL;
+    }
+    next = testa->next;
+    allocatoreNodi->restituisci(allocatoreNodi, testa);
+    return next;
+}
+
+// Elimina il primo nodo con il valore indicato (se c'è)
+Nodo* eliminaNodo(Nodo* testa, int valore) {
+    Nodo** link = &testa;   // puntatore al campo che punta al nodo esaminato
+    while (*link != NULL && (*link)->valore != valore) {
+        link = &(*link)->next;
+    }
+    if (*link != NULL) {
+        Nodo* nodo = *link;
+        *link = nodo->next;
+        allocatoreNodi->restituisci(allocatoreNodi, nodo);
+    }
+    return testa;
+}
+
+// Primo nodo con il valore indicato, NULL se non c'è
+Nodo* cercaNodo(Nodo* testa, int valore) {
+    while (testa != NULL && testa->valore != valore) {
+        testa = testa->next;
+    }
+    return testa;
+}
+
+void visualizzaLista(Nodo* testa) {
+    for (; testa != NULL; testa = testa->next) {
+        uscitaIntero(testa->valore);
+        uscitaTesto(" -> ");
+    }
+    uscitaTesto("NULL\n");
+    uscitaSvuota();
+}
+
+// Restituisce all'allocatore i nodi della lista, uno per uno (con un'arena
+// finiscono nella sua lista di nodi liberi, senza free)
+void liberaLista(Nodo* testa) {
+    while (testa != NULL) {
+        Nodo* next = testa->next;
+        allocatoreNodi->restituisci(allocatoreNodi, testa);
+        testa = next;
+    }
+}
@@ -0,0 +1,91 @@
+/** ****************************************************************************************
+* @file lista02.h
+* @brief Libreria C per le liste concatenate di lista02_esercizio.c, con allocatore dei nodi intercambiabile
+*
+* Le funzioni sono quelle dichiarate nell'esercizio (creaNodo, inserisciInTesta,
+* inserisciInCoda, inserisciInPosizione, eliminaTesta, eliminaNodo, cercaNodo,
+* visualizzaLista, liberaLista) e sono implementate in lista02.c. I nodi non
+* vengono presi direttamente con malloc/free ma da un "allocatore", scelto con
+* usaAllocatore() e unico per tutto il programma:
+*  - allocatoreMalloc (predefinito): ogni nodo è una malloc e una free;
+*  - un'ArenaNodi: i nodi vengono presi a blocchi, uno dopo l'altro (quindi
+*    vicini in memoria); i nodi eliminati, anche da liberaLista(), tornano in
+*    una lista di nodi liberi e vengono riusati senza chiamare malloc. La
+*    memoria dei blocchi resta all'arena fino a distruggiArena().
+*    svuotaArena() restituisce in O(1) tutti i nodi dell'arena, di tutte le
+*    liste costruite con essa, senza percorrerle.
+*
+* Una lista va liberata con lo stesso allocatore con cui è stata costruita:
+* usaAllocatore() si chiama solo quando non ci sono liste con nodi
+* dell'allocatore precedente.
+*
+* Esempio:
+*   ArenaNodi arena;
+*   inizializzaArena(&arena);
+*   usaAllocatore(&arena.base);
+*   for (i = 0; i < 1000000; i++) lista = inserisciInTesta(lista, i);
+*   svuotaArena(&arena);                // O(1): lista non è più valida
+*   usaAllocatore(&allocatoreMalloc);
+*   distruggiArena(&arena);
+*
+* Compilazione: gcc -std=c99 -O2 programma.c lista02.c -o programma
+* (vedi lista02_esercizio.c e bench_lista02.c)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef LISTA02_H
+#define LISTA02_H
+
+typedef struct Nodo {
+    int valore;
+    struct Nodo *next;
+} Nodo;
+
+//------------------------------------------------------------------------------------------
+//=== ALLOCATORI DEI NODI ==================================================================
+//------------------------------------------------------------------------------------------
+
+// Un allocatore di nodi: due funzioni che ricevono l'allocatore stesso
+typedef struct Allocatore {
+    Nodo* (*prendi)(struct Allocatore* a);          // NULL se la memoria è finita
+    void (*restituisci)(struct Allocatore* a, Nodo* nodo);
+} Allocatore;
+
+extern Allocatore allocatoreMalloc;
+
+typedef struct ArenaNodi {
+    Allocatore base;               // primo campo: &arena.base si passa a usaAllocatore
+    struct BloccoArena* blocchi;   // primo blocco
+    struct BloccoArena* corrente;  // blocco da cui si prendono i nodi nuovi
+    int usati;                     // nodi già presi da corrente
+    Nodo* liberi;                  // nodi restituiti, collegati con next
+} ArenaNodi;
+
+void inizializzaArena(ArenaNodi* arena);
+
+// Tutti i nodi dell'arena tornano disponibili in O(1): le liste costruite con essa non vanno più usate
+void svuotaArena(ArenaNodi* arena);
+
+// Libera i blocchi: i nodi dell'arena non vanno più usati
+void distruggiArena(ArenaNodi* arena);
+
+// Allocatore usato da creaNodo, eliminaTesta, eliminaNodo e liberaLista
+void usaAllocatore(Allocatore* a);
+
+//------------------------------------------------------------------------------------------
+//=== OPERAZIONI SULLA LISTA ===============================================================
+//------------------------------------------------------------------------------------------
+
+Nodo* creaNodo(int valore);
+Nodo* inserisciInTesta(Nodo* testa, int valore);
+Nodo* inserisciInCoda(Nodo* testa, int valore);
+Nodo* inserisciInPosizione(Nodo* testa, int valore, int posizione);
+Nodo* eliminaTesta(Nodo* testa);
+Nodo* eliminaNodo(Nodo* testa, int valore);
+Nodo* cercaNodo(Nodo* testa, int valore);
+void visualizzaLista(Nodo* testa);
+void liberaLista(Nodo* testa);
+
+#endif
@@ -1,21 +1,7 @@
+// Compilazione: gcc -std=c99 lista02_esercizio.c lista02.c -o lista02_esercizio
 #include <stdio.h>
 #include <stdlib.h>
-
-typedef struct Nodo {
-    int valore;
-    struct Nodo *next;
-} Nodo;
-
-// Prototipi delle funzioni
-Nodo* creaNodo(int valore);
-Nodo* inserisciInTesta(Nodo* testa, int valore);
-Nodo* inserisciInCoda(Nodo* testa, int valore);
-Nodo* inserisciInPosizione(Nodo* testa, int valore, int posizione);
-Nodo* eliminaTesta(Nodo* testa);
-Nodo* eliminaNodo(Nodo* testa, int valore);
-Nodo* cercaNodo(Nodo* testa, int valore);
-void visualizzaLista(Nodo* testa);
-void liberaLista(Nodo* testa);
+#include "lista02.h" // Nodo e le funzioni sulla lista: creaNodo, inserisciInTesta, ..., liberaLista
 
 int main() {
     Nodo* lista = NULL; // Iniziamo con una lista vuota
@@ -48,8 +34,20 @@ int main() {
     // Liberiamo la memoria
     liberaLista(lista);
     
+    // Le stesse operazioni con i nodi presi da un'arena
+    ArenaNodi arena;
+    inizializzaArena(&arena);
+    usaAllocatore(&arena.base);
+    lista = NULL;
+    for (int i = 1; i <= 5; i++) {
+        lista = inserisciInCoda(lista, i * 10);
+    }
+    lista = eliminaNodo(lista, 30);
+    lista = inserisciInPosizione(lista, 25, 2);
+    visualizzaLista(lista); // Output: 10 -> 20 -> 25 -> 40 -> 50 -> NULL
+    liberaLista(lista);     // i nodi tornano all'arena, pronti per la lista successiva
+    usaAllocatore(&allocatoreMalloc);
+    distruggiArena(&arena);
+    
     return 0;
-}
-
-// Implementazioni delle funzioni
-// ...
\ No newline at end of file
+}
\ No newline at end of file
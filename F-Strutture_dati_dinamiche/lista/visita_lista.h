@@ -0,0 +1,67 @@
+/** ****************************************************************************************
+* @file visita_lista.h
+* @brief Visita di una lista concatenata senza ricorsione: un ciclo unico per stampa, ricerca, somma...
+*
+* Le versioni ricorsive di lista01.cpp (stampa_listaR, cerca_eleR) fanno una
+* chiamata per nodo: sono "tail recursive", ma il C++ non obbliga il
+* compilatore a trasformarle in un ciclo. Senza ottimizzazioni (-O0, la
+* modalità di debug) ogni nodo occupa un record di attivazione sullo stack e
+* con qualche centinaio di migliaia di nodi il programma termina per stack
+* overflow.
+*
+* visitaLista(p, visita) percorre la lista con un ciclo (stack costante) e
+* chiama visita(nodo) per ogni nodo: se visita restituisce true la visita si
+* ferma lì (uscita anticipata) e viene restituito quel nodo, altrimenti si
+* arriva alla fine e viene restituito NULL. Mentre visita lavora su un nodo
+* viene chiesto in anticipo alla cache il successivo del successivo
+* (next->next): serve quando visita fa un lavoro non banale; con visite
+* leggere (una ricerca) il tempo resta quello della catena di puntatori, circa
+* 200 ns per nodo con i nodi sparsi in memoria (vedi bench_visita_lista.cpp).
+*
+* Esempi (nodo come in lista01.cpp):
+*   // stampa
+*   visitaLista(p, [](pNodo q) { cout << "[" << q->info << "]->"; return false; });
+*   // ricerca: primo nodo con info == e, NULL se non c'è
+*   pNodo trovato = visitaLista(p, [e](pNodo q) { return q->info == e; });
+*   // somma, con perOgniNodo quando non serve l'uscita anticipata
+*   long long somma = 0;
+*   perOgniNodo(p, [&](pNodo q) { somma += q->info; });
+*
+* Uso: #include "visita_lista.h" (vedi lista01.cpp e bench_visita_lista.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef VISITA_LISTA_H
+#define VISITA_LISTA_H
+
+#include <stddef.h>
+
+// Visita i nodi da p fino al primo per cui visita(nodo) è true (restituito) o alla fine (NULL)
+template <typename Nodo, typename Visitatore>
+Nodo* visitaLista(Nodo* p, Visitatore visita)
+{
+    while (p != NULL)
+    {
+        Nodo* successivo = p->next;
+        if (successivo != NULL)
+            __builtin_prefetch(successivo->next);
+        if (visita(p))
+            return (p);
+        p = successivo;
+    }
+    return (NULL);
+}
+
+// Come visitaLista, per le visite che non si fermano mai
+template <typename Nodo, typename Azione>
+void perOgniNodo(Nodo* p, Azione azione)
+{
+    visitaLista(p, [&](Nodo* q) {
+        azione(q);
+        return false;
+    });
+}
+
+#endif
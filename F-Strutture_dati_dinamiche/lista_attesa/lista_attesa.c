@@ -3,6 +3,7 @@
 #include <time.h>
 #include <stdbool.h>
 #include <windows.h>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
 
 // Definizione dei codici colore ANSI
 #define VERDE "\033[1;32m"
@@ -131,42 +132,54 @@ double calcolaTempoMedioAttesa(ListaAttesa* lista) {
 void visualizzaStatoCorrente(ListaAttesa* lista, Sportello* sportello1, Sportello* sportello2) {
     system("cls"); // Pulisce lo schermo (Windows)
     
-    printf("%s===== SISTEMA GESTIONE LISTA D'ATTESA =====%s\n\n", VERDE, RESET);
+    uscitaTesto(VERDE "===== SISTEMA GESTIONE LISTA D'ATTESA =====" RESET "\n\n");
     
     // Visualizza lo stato degli sportelli
-    printf("%sSportello 1: %s", AZZURRO, RESET);
+    uscitaTesto(AZZURRO "Sportello 1: " RESET);
     if (sportello1->attivo) {
-        printf("Servendo cliente numero %s%d%s\n", VERDE, sportello1->cliente_corrente, RESET);
+        uscitaTesto("Servendo cliente numero " VERDE);
+        uscitaIntero(sportello1->cliente_corrente);
+        uscitaTesto(RESET "\n");
     } else {
-        printf("%sInattivo%s\n", GIALLO, RESET);
+        uscitaTesto(GIALLO "Inattivo" RESET "\n");
     }
     
-    printf("%sSportello 2: %s", AZZURRO, RESET);
+    uscitaTesto(AZZURRO "Sportello 2: " RESET);
     if (sportello2->attivo) {
-        printf("Servendo cliente numero %s%d%s\n", VERDE, sportello2->cliente_corrente, RESET);
+        uscitaTesto("Servendo cliente numero " VERDE);
+        uscitaIntero(sportello2->cliente_corrente);
+        uscitaTesto(RESET "\n");
     } else {
-        printf("%sInattivo%s\n", GIALLO, RESET);
+        uscitaTesto(GIALLO "Inattivo" RESET "\n");
     }
     
     // Visualizza informazioni sulla lista d'attesa
-    printf("\n%sClienti in attesa: %d%s\n", GIALLO, lista->clienti_in_attesa, RESET);
+    uscitaTesto("\n" GIALLO "Clienti in attesa: ");
+    uscitaIntero(lista->clienti_in_attesa);
+    uscitaTesto(RESET "\n");
     
     if (lista->clienti_in_attesa > 0) {
         double tempo_medio = calcolaTempoMedioAttesa(lista);
-        printf("%sTempo medio di attesa stimato: %.0f secondi%s\n", GIALLO, tempo_medio, RESET);
-        printf("%sProssimo numero da servire: %d%s\n", VERDE, lista->testa->numero, RESET);
+        uscitaTesto(GIALLO "Tempo medio di attesa stimato: ");
+        uscitaDecimale(tempo_medio, 0);
+        uscitaTesto(" secondi" RESET "\n");
+        uscitaTesto(VERDE "Prossimo numero da servire: ");
+        uscitaIntero(lista->testa->numero);
+        uscitaTesto(RESET "\n");
     }
     
-    printf("\n");
+    uscitaTesto("\n");
+    uscitaSvuota(); // una sola scrittura per tutta la schermata
 }
 
 // Funzione per visualizzare il menu
 void visualizzaMenu() {
-    printf("%s1. Servi prossimo cliente allo Sportello 1%s\n", AZZURRO, RESET);
-    printf("%s2. Servi prossimo cliente allo Sportello 2%s\n", AZZURRO, RESET);
-    printf("%s3. Aggiungi nuovo cliente%s\n", VERDE, RESET);
-    printf("%s0. Esci%s\n\n", ROSSO, RESET);
-    printf("%sScelta: %s", GIALLO, RESET);
+    uscitaTesto(AZZURRO "1. Servi prossimo cliente allo Sportello 1" RESET "\n");
+    uscitaTesto(AZZURRO "2. Servi prossimo cliente allo Sportello 2" RESET "\n");
+    uscitaTesto(VERDE "3. Aggiungi nuovo cliente" RESET "\n");
+    uscitaTesto(ROSSO "0. Esci" RESET "\n\n");
+    uscitaTesto(GIALLO "Scelta: " RESET);
+    uscitaSvuota();
 }
 
 // Funzione per liberare la memoria della lista d'attesa
@@ -0,0 +1,191 @@
+/** ****************************************************************************************
+* @file bench_pila01.cpp
+* @brief Creazione e distruzione di una pila di 10M elementi casuali: nodo per nodo o in un blocco
+*
+* 1) Verifica: una pila di creaPilaRandomBlocco ha esattamente N nodi, dati
+*    da 1 a 9 con frequenze uguali (entro 6 deviazioni standard), si svuota con pop1 e con lo
+*    stesso seme si ottiene la stessa pila.
+* 2) ns per elemento (il migliore di 3), per N elementi:
+*    - creaPilaRandom di pila01.cpp (rand() e new per ogni push) e liberaPila
+*      (una delete per nodo);
+*    - le stesse push con new ma i dati da xoshiro128**: separa il costo del
+*      generatore da quello dell'allocatore;
+*    - creaPilaRandomBlocco e liberaPilaBlocco di pila_blocco.h.
+*    Per ciascuna anche la somma degli elementi percorrendo la pila, che
+*    mostra l'effetto dei nodi contigui.
+*
+* Compilazione ed esecuzione:
+*   g++ -std=c++17 -O2 bench_pila01.cpp -o bench_pila01
+*   ./bench_pila01 [N, default 10000000]
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "pila_blocco.h"
+
+struct s_nodo
+{
+    int info;
+    s_nodo *next;
+};
+typedef struct s_nodo nodo;
+typedef nodo *pNodo;
+
+// Le funzioni di pila01.cpp
+pNodo push(pNodo pTesta, int elemento)
+{
+    pNodo pNuovo = new nodo;
+    pNuovo->info = elemento;
+    pNuovo->next = pTesta;
+    pTesta = pNuovo;
+    return pTesta;
+}
+
+pNodo pop1(pNodo pTesta)
+{
+    if (pTesta != NULL)
+        pTesta = pTesta->next;
+    return pTesta;
+}
+
+pNodo creaPilaRandom(int quanti)
+{
+    pNodo pTesta = NULL;
+    for (int x = 0; x < quanti; x++)
+        pTesta = push(pTesta, rand() % 9 + 1);
+    return pTesta;
+}
+
+pNodo liberaPila(pNodo pTesta)
+{
+    while (pTesta != NULL)
+    {
+        pNodo pTempo = pTesta;
+        pTesta = pTesta->next;
+        delete pTempo;
+    }
+    return pTesta;
+}
+
+// creaPilaRandom con i dati da xoshiro128**
+pNodo creaPilaRandomXoshiro(int quanti, uint64_t seme)
+{
+    Xoshiro128 casuale(seme);
+    pNodo pTesta = NULL;
+    for (int x = 0; x < quanti; x++)
+        pTesta = push(pTesta, (int)(((uint64_t)casuale() * 9) >> 32) + 1);
+    return pTesta;
+}
+
+static double secondi(std::chrono::steady_clock::time_point inizio)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inizio).count();
+}
+
+static long long somma(pNodo p)
+{
+    long long s = 0;
+    for (; p != NULL; p = p->next)
+        s += p->info;
+    return s;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 1) VERIFICA ==========================================================================
+//------------------------------------------------------------------------------------------
+static bool verifica(int n)
+{
+    BloccoPila<nodo> blocco, altro;
+    pNodo pTesta = creaPilaRandomBlocco(n, blocco, 7);
+    pNodo pAltra = creaPilaRandomBlocco(n, altro, 7);
+    long long frequenze[10] = {0};
+    int contati = 0;
+    bool ok = blocco.quanti == n;
+    for (pNodo p = pTesta, q = pAltra; p != NULL; p = p->next, q = q->next)
+    {
+        if (p->info < 1 || p->info > 9 || q == NULL || q->info != p->info)
+            return false;
+        frequenze[p->info]++;
+        contati++;
+    }
+    for (int d = 1; d <= 9; d++)
+        ok = ok && llabs(frequenze[d] * 9 - n) <= 6 * sqrt(8.0 * n);   // 6 deviazioni standard
+    int tolti = 0;
+    while (pTesta != NULL)
+    {
+        pTesta = pop1(pTesta);
+        tolti++;
+    }
+    liberaPilaBlocco(blocco);
+    liberaPilaBlocco(altro);
+    ok = ok && blocco.nodi == NULL && creaPilaRandomBlocco(0, blocco, 1) == NULL;
+    return ok && contati == n && tolti == n;
+}
+
+//------------------------------------------------------------------------------------------
+//=== 2) TEMPI =============================================================================
+//------------------------------------------------------------------------------------------
+struct Tempi
+{
+    double crea, visita, libera;   // ns per elemento
+};
+
+template <typename Crea, typename Libera>
+static Tempi misura(int n, Crea crea, Libera libera)
+{
+    Tempi migliori = {1e30, 1e30, 1e30};
+    for (int r = 0; r < 3; r++)
+    {
+        auto inizio = std::chrono::steady_clock::now();
+        pNodo pTesta = crea();
+        double tCrea = secondi(inizio);
+        inizio = std::chrono::steady_clock::now();
+        long long s = somma(pTesta);
+        double tVisita = secondi(inizio);
+        if (s < n || s > 9LL * n)
+        {
+            printf("ERRORE: somma %lld fuori dall'intervallo\n", s);
+            exit(1);
+        }
+        inizio = std::chrono::steady_clock::now();
+        libera(pTesta);
+        double tLibera = secondi(inizio);
+        migliori.crea = std::min(migliori.crea, tCrea / n * 1e9);
+        migliori.visita = std::min(migliori.visita, tVisita / n * 1e9);
+        migliori.libera = std::min(migliori.libera, tLibera / n * 1e9);
+    }
+    return migliori;
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    bool ok = verifica(std::min(n, 1000000));
+    printf("Verifica: %s\n\n", ok ? "pila del blocco corretta" : "ERRORE");
+
+    Tempi t[3];
+    t[0] = misura(n, [&]
+                  { return creaPilaRandom(n); }, [](pNodo p)
+                  { liberaPila(p); });
+    t[1] = misura(n, [&]
+                  { return creaPilaRandomXoshiro(n, 1); }, [](pNodo p)
+                  { liberaPila(p); });
+    BloccoPila<nodo> blocco;
+    t[2] = misura(n, [&]
+                  { return creaPilaRandomBlocco(n, blocco, 1); }, [&](pNodo)
+                  { liberaPilaBlocco(blocco); });
+
+    const char *nomi[3] = {"creaPilaRandom (rand + new)", "push con new, xoshiro128**",
+                           "creaPilaRandomBlocco"};
+    printf("ns per elemento, %d elementi\n", n);
+    printf("%-30s %12s %12s %14s\n", "", "creazione", "visita", "distruzione");
+    for (int v = 0; v < 3; v++)
+        printf("%-30s %12.2f %12.2f %14.3f\n", nomi[v], t[v].crea, t[v].visita, t[v].libera);
+    return ok ? 0 : 1;
+}
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <vector>
 #include <iostream>
+#include "../comune/uscita_buffer.h" // uscitaTesto, uscitaIntero, uscitaSvuota
+#include "pila_blocco.h"             // creaPilaRandomBlocco, liberaPilaBlocco
 
 
 using namespace std;
@@ -35,10 +37,13 @@ void stampa_pila(pNodo pila1)
 { // versione iterativa
     while (pila1 != NULL)
     {
-        cout << "\n| " << pila1->info << " |";
+        uscitaTesto("\n| ");
+        uscitaIntero(pila1->info);
+        uscitaTesto(" |");
         pila1 = pila1->next;
     }
-    cout << "\n|____|\n\n";
+    uscitaTesto("\n|____|\n\n");
+    uscitaSvuota(); // una sola scrittura per tutta la pila
 }
 
 // FUNZIONE DI PRELEVAMENTO DI UN NODO DALLA TESTA DELLA PILA  (senza comunicazioni)
@@ -65,7 +70,7 @@ pNodo pop(pNodo pTesta)
             pTesta = pTesta->next;
         else
             pTesta = NULL;
-        free(pTempo); // dealloco lo spazio
+        delete pTempo; // dealloco lo spazio (il nodo è stato creato con new)
     }
     return pTesta;
 }
@@ -94,6 +99,14 @@ pNodo creaPilaRandom(int quanti)
     return pTesta;
 }; /* crea pila di quantie lementi  */
 
+// FUNZIONE DI RILASCIO DI TUTTI I NODI DELLA PILA (creati con push)
+pNodo liberaPila(pNodo pTesta)
+{
+    while (pTesta != NULL)
+        pTesta = pop(pTesta);
+    return pTesta;
+}
+
 // FUNZIONE DI STAMPA A VIDEO DEI NODI DELLA PILA
 void stampa_pila_grafica(pNodo pTesta)
 {
@@ -111,15 +124,20 @@ void stampa_pila_grafica(pNodo pTesta)
         // stampo la pila
         system("clear"); // CLS per Windows
         x = 1;
-        printf("\n\n\n\t_                       _ \n\t");
-        printf("|                       |  Testa della pila\n\t");
+        uscitaTesto("\n\n\n\t_                       _ \n\t");
+        uscitaTesto("|                       |  Testa della pila\n\t");
         while (pTesta != NULL)
         {
-            printf("| %2d^ nodo = %3d\t|\n\t", --num, pTesta->info);
+            uscitaTesto("| ");
+            uscitaInteroLargo(--num, 2);
+            uscitaTesto("^ nodo = ");
+            uscitaInteroLargo(pTesta->info, 3);
+            uscitaTesto("\t|\n\t");
             pTesta = pTesta->next;
             x = x + 1;
         }
-        printf("|_______________________|  Fondo della pila\n\n\t");
+        uscitaTesto("|_______________________|  Fondo della pila\n\n\t");
+        uscitaSvuota();
     }
     else
     {
@@ -147,4 +165,16 @@ int main()
     system("sleep 2"); // pausa di 2 secondi // pause per Windows
     pTesta2 = creaPilaRandom(4);
     stampa_pila_grafica(pTesta2); // visualizza la lista
+
+    // pila casuale costruita in un solo blocco: si svuota con pop1 e si libera tutta insieme
+    BloccoPila<nodo> blocco;
+    pNodo pTesta3 = creaPilaRandomBlocco(5, blocco, 2026);
+    cout << "\npila di 5 elementi casuali in un solo blocco" << endl;
+    stampa_pila(pTesta3);
+    pTesta3 = pop1(pTesta3);
+    stampa_pila(pTesta3);
+    liberaPilaBlocco(blocco);
+
+    pTesta1 = liberaPila(pTesta1);
+    pTesta2 = liberaPila(pTesta2);
 }
@@ -0,0 +1,121 @@
+/** ****************************************************************************************
+* @file pila_blocco.h
+* @brief Pila di milioni di elementi casuali costruita in un solo blocco di memoria
+*
+* creaPilaRandom di pila01.cpp fa, per ogni elemento, una chiamata a rand() e
+* una new (con push): con milioni di elementi la maggior parte del tempo va
+* nell'allocatore, i nodi finiscono sparsi nello heap e per liberare la pila
+* serve una delete per nodo.
+*
+* creaPilaRandomBlocco(quanti, blocco) invece:
+*  - alloca tutti i nodi insieme in un array (una sola new[]);
+*  - li collega in un solo passaggio: la testa è il primo nodo dell'array e
+*    ogni next punta al nodo successivo in memoria, quindi percorrere la pila
+*    significa leggere la memoria in ordine;
+*  - genera i dati (da 1 a 9, come creaPilaRandom) con xoshiro128**, un
+*    generatore più veloce di rand() e con la sequenza indipendente dal
+*    sistema operativo, a partire da un seme.
+* liberaPilaBlocco(blocco) restituisce tutta la memoria con una sola delete[],
+* in O(1) rispetto al numero di nodi.
+*
+* I nodi del blocco non vanno liberati uno alla volta: per togliere elementi
+* da una pila creata così si usa pop1 (che non rilascia la RAM), non pop.
+*
+* Esempio (nodo come in pila01.cpp):
+*   BloccoPila<nodo> blocco;
+*   pNodo pTesta = creaPilaRandomBlocco(10000000, blocco, 1);
+*   pTesta = pop1(pTesta);
+*   liberaPilaBlocco(blocco);   // pTesta non è più valido
+*
+* Uso: #include "pila_blocco.h" (vedi pila01.cpp e bench_pila01.cpp)
+*
+* @author Filippo Bilardo
+* @date 18/10/2026
+* @version 1.0 18/10/2026 Versione iniziale
+*/
+#ifndef PILA_BLOCCO_H
+#define PILA_BLOCCO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Generatore xoshiro128** (Blackman e Vigna): 128 bit di stato, 32 bit per chiamata
+struct Xoshiro128
+{
+    uint32_t s[4];
+
+    // Stato iniziale ricavato dal seme con splitmix64 (uno stato tutto a zero non è valido)
+    explicit Xoshiro128(uint64_t seme)
+    {
+        for (int i = 0; i < 4; i += 2)
+        {
+            uint64_t z = (seme += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            z ^= z >> 31;
+            s[i] = (uint32_t)z;
+            s[i + 1] = (uint32_t)(z >> 32);
+        }
+    }
+
+    uint32_t operator()()
+    {
+        uint32_t risultato = ruota(s[1] * 5, 7) * 9;
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = ruota(s[3], 11);
+        return risultato;
+    }
+
+    static uint32_t ruota(uint32_t x, int k)
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+};
+
+// Il blocco di nodi di una pila creata da creaPilaRandomBlocco
+template <typename Nodo>
+struct BloccoPila
+{
+    Nodo* nodi = NULL;
+    int quanti = 0;
+};
+
+// Crea una pila di quanti elementi casuali da 1 a 9 in un solo blocco; restituisce la testa
+template <typename Nodo>
+Nodo* creaPilaRandomBlocco(int quanti, BloccoPila<Nodo>& blocco, uint64_t seme)
+{
+    if (quanti <= 0)
+    {
+        blocco.nodi = NULL;
+        blocco.quanti = 0;
+        return (NULL);
+    }
+    Xoshiro128 casuale(seme);
+    Nodo* nodi = new Nodo[quanti];
+    for (int x = 0; x < quanti; x++)
+    {
+        // da 1 a 9 con una moltiplicazione al posto di % 9
+        nodi[x].info = (int)(((uint64_t)casuale() * 9) >> 32) + 1;
+        nodi[x].next = &nodi[x + 1];
+    }
+    nodi[quanti - 1].next = NULL;
+    blocco.nodi = nodi;
+    blocco.quanti = quanti;
+    return (nodi);
+}
+
+// Libera tutti i nodi del blocco in una volta
+template <typename Nodo>
+void liberaPilaBlocco(BloccoPila<Nodo>& blocco)
+{
+    delete[] blocco.nodi;
+    blocco.nodi = NULL;
+    blocco.quanti = 0;
+}
+
+#endif